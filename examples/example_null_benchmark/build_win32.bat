@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Release
+cl /nologo /O2 /MD /I . /I .. /I ..\.. /I ..\..\misc\fileviewer /DIMGUI_USER_CONFIG=\"imconfig_benchmark.h\" *.cpp ..\imgui_impl_softraster.cpp ..\..\misc\fileviewer\imgui_file_viewer.cpp ..\..\*.cpp /FeRelease/example_null_benchmark.exe /FoRelease/ /link gdi32.lib shell32.lib
@@ -0,0 +1,15 @@
+//-----------------------------------------------------------------------------
+// COMPILE-TIME OPTIONS FOR THE BENCHMARK APPLICATION
+// Built with IMGUI_USER_CONFIG="imconfig_benchmark.h": use the same settings as imconfig.h,
+// except that the demo windows are compiled in so the "demo_window" scenario has something to measure.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include "imconfig.h"
+
+#undef IMGUI_DISABLE_DEMO_WINDOWS
+
+//#define IMGUI_USE_FAST_HASH       // Uncomment to compare ID hashing throughput and collisions (see 'hash_ids' scenario)
+//#define IMGUI_USE_HASHED_STORAGE  // Uncomment to compare ImGuiStorage layouts (see 'storage_insert', 'storage_lookup' scenarios)
+//#define IMGUI_USE_COMPACT_DRAWVERT // Uncomment to compare vertex layouts (see 'upload_bytes' counts)
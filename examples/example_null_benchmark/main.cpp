@@ -0,0 +1,1239 @@
+// dear imgui: null/dummy benchmark application
+// (compile and link imgui, create context, run fixed scenarios headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// Each scenario is run through NewFrame()->Render() for a number of frames and the results are printed as JSON:
+// per-phase timings, vertex/index/command counts and allocation counts. Compare the output of two builds to catch regressions.
+// With --raster, the draw data of every frame is also rendered by the software rasterizer (imgui_impl_softraster.cpp) to measure fill cost.
+// Usage: example_null_benchmark [--frames N] [--warmup N] [--scenario NAME] [--cjk-font FILE.ttf] [--threads N] [--raster] [--out FILE.json] [--list]
+// The 'font_atlas_cjk*' scenarios need a font with CJK glyphs (e.g. NotoSansCJK, not provided) and are skipped without --cjk-font.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include "imgui_file_viewer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Allocation tracking
+//-----------------------------------------------------------------------------
+
+struct BenchAllocStats
+{
+    int     AllocCount;
+    int     FreeCount;
+    size_t  AllocBytes;
+};
+static BenchAllocStats g_AllocStats = { 0, 0, 0 };
+
+static void* BenchMallocWrapper(size_t size, void* user_data)
+{
+    (void)user_data;
+    g_AllocStats.AllocCount++;
+    g_AllocStats.AllocBytes += size;
+    return malloc(size);
+}
+
+static void BenchFreeWrapper(void* ptr, void* user_data)
+{
+    (void)user_data;
+    if (ptr)
+        g_AllocStats.FreeCount++;
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Timing helpers
+//-----------------------------------------------------------------------------
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double BenchElapsedMs(BenchClock::time_point t0, BenchClock::time_point t1)
+{
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+// Accumulate min/max/average of a series of samples
+struct BenchSeries
+{
+    double  Min, Max, Sum;
+    int     Count;
+
+    BenchSeries()               { Min = 0.0; Max = 0.0; Sum = 0.0; Count = 0; }
+    void    Add(double v)       { if (Count == 0 || v < Min) Min = v; if (Count == 0 || v > Max) Max = v; Sum += v; Count++; }
+    double  Avg() const         { return Count > 0 ? Sum / Count : 0.0; }
+};
+
+// Scenario specific values, printed in the "extra" section of the scenario output
+struct BenchExtraValue
+{
+    const char* Name;
+    double      Value;
+};
+static ImVector<BenchExtraValue> g_ExtraValues;
+
+static void BenchSetExtraValue(const char* name, double value)
+{
+    for (int n = 0; n < g_ExtraValues.Size; n++)
+        if (strcmp(g_ExtraValues[n].Name, name) == 0)
+        {
+            g_ExtraValues[n].Value = value;
+            return;
+        }
+    BenchExtraValue extra_value = { name, value };
+    g_ExtraValues.push_back(extra_value);
+}
+
+//-----------------------------------------------------------------------------
+// Scenarios
+//-----------------------------------------------------------------------------
+
+struct BenchOptions
+{
+    int         Frames;
+    int         WarmupFrames;
+    const char* ScenarioFilter;
+    const char* CjkFontFilename;                        // NULL: skip 'font_atlas_cjk*' scenarios
+    int         Threads;                                // Worker threads for ImFontAtlas::ParallelForFn and the software rasterizer
+    bool        Raster;                                 // Render draw data with imgui_impl_softraster.cpp after Render()
+    const char* OutputFilename;
+};
+
+struct BenchScenario
+{
+    const char* Name;
+    const char* Desc;
+    void        (*Init)(const BenchOptions& opts);      // Optional, called before the first frame
+    void        (*Frame)(const BenchOptions& opts);     // Submit contents, called between NewFrame() and Render()
+    void        (*Shutdown)();                          // Optional, called after the last frame
+    bool        NoFrame;                                // Measure Frame() alone instead of NewFrame()->Render() (font atlas builds, data structures)
+};
+
+// Full-display window hosting the scenario contents
+static bool BeginBenchWindow(const char* name)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    return ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+}
+
+static void FrameDemoWindow(const BenchOptions&)
+{
+    ImGui::ShowDemoWindow(NULL);
+}
+
+static void FrameTextLines(const BenchOptions&)
+{
+    if (BeginBenchWindow("TextLines"))
+    {
+        char buf[64];
+        for (int n = 0; n < 10000; n++)
+        {
+            sprintf(buf, "%05d The quick brown fox jumps over the lazy dog", n);
+            ImGui::TextUnformatted(buf);
+        }
+    }
+    ImGui::End();
+}
+
+static void FrameTreeNodes(bool open)
+{
+    if (BeginBenchWindow(open ? "TreeNodesExpanded" : "TreeNodesCollapsed"))
+    {
+        for (int n = 0; n < 1000; n++)
+        {
+            ImGui::SetNextItemOpen(open, ImGuiCond_Always);
+            if (ImGui::TreeNode((void*)(intptr_t)n, "Node %d", n))
+            {
+                ImGui::Text("Contents of node %d", n);
+                ImGui::TreePop();
+            }
+        }
+    }
+    ImGui::End();
+}
+static void FrameTreeNodesCollapsed(const BenchOptions&)    { FrameTreeNodes(false); }
+static void FrameTreeNodesExpanded(const BenchOptions&)     { FrameTreeNodes(true); }
+
+static void FrameColumns(const BenchOptions&)
+{
+    if (BeginBenchWindow("Columns"))
+    {
+        const int COLUMNS_COUNT = 12;
+        ImGui::Columns(COLUMNS_COUNT, "bench_columns", true);
+        for (int row = 0; row < 400; row++)
+            for (int column = 0; column < COLUMNS_COUNT; column++)
+            {
+                ImGui::Text("R%03d C%02d", row, column);
+                ImGui::NextColumn();
+            }
+        ImGui::Columns(1);
+    }
+    ImGui::End();
+}
+
+// Same labels every frame: measured through the text layout cache
+static void FrameLabelsStatic(const BenchOptions&)
+{
+    if (BeginBenchWindow("LabelsStatic"))
+    {
+        char label[64];
+        for (int n = 0; n < 1000; n++)
+        {
+            ImGui::PushID(n);
+            sprintf(label, "Button with a reasonably long label %d", n);
+            ImGui::Button(label);
+            sprintf(label, "Selectable item with a reasonably long label %d", n);
+            ImGui::Selectable(label);
+            ImGui::PopID();
+        }
+    }
+    ImGui::End();
+}
+
+// Dashboard: 48 mostly static panels. With 'reuse', each panel passes a hash of its contents to SetNextWindowContentHash()
+// and panels which are not interacted with submit last frame's geometry again instead of being regenerated.
+static void FrameDashboard(bool reuse, bool live_panel = false)
+{
+    const int PANELS_COUNT = 48;
+    int panels_submitted = 0;
+    for (int panel_n = 0; panel_n < PANELS_COUNT; panel_n++)
+    {
+        char name[32];
+        sprintf(name, "Panel %02d", panel_n);
+        ImGui::SetNextWindowPos(ImVec2((float)(panel_n % 8) * 240.0f, (float)(panel_n / 8) * 180.0f));
+        ImGui::SetNextWindowSize(ImVec2(236.0f, 176.0f));
+        if (reuse)
+            ImGui::SetNextWindowContentHash((ImGuiID)panel_n + 1); // Contents below only depend on panel_n
+        const bool live = (live_panel && panel_n == 0);
+        if (ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings))
+        {
+            float values[64];
+            for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+                values[n] = sinf((n + panel_n) * 0.2f);
+            ImGui::Text("Sensor %d", panel_n);
+            if (live)
+                ImGui::Text("Status: nominal, frame %d", ImGui::GetFrameCount());
+            else
+                ImGui::Text("Status: nominal, %d alarms", panel_n % 3);
+            ImGui::ProgressBar((panel_n % 10) / 10.0f);
+            ImGui::PlotLines("##values", values, IM_ARRAYSIZE(values), 0, NULL, -1.0f, 1.0f, ImVec2(-1.0f, 50.0f));
+            ImGui::Button("Details");
+            ImGui::SameLine();
+            ImGui::Button("Reset");
+            panels_submitted++;
+        }
+        ImGui::End();
+    }
+    BenchSetExtraValue("panels_submitted", panels_submitted);
+}
+static void FrameDashboard(const BenchOptions&)         { FrameDashboard(false); }
+static void FrameDashboardReuse(const BenchOptions&)    { FrameDashboard(true); }
+static void InitDashboardDamage(const BenchOptions&)    { ImGui::GetIO().ConfigDrawDataDamageRects = true; }
+static void FrameDashboardDamage(const BenchOptions&)   { FrameDashboard(false, true); }
+
+// Merged buffers: copy the draw data of the dashboard and demo window (49 command lists) into single vertex/index buffers,
+// as a renderer would do to upload them at once. The first call checks that every merged command draws the same vertices.
+static ImVector<ImDrawVert>     g_MergedVtxBuffer;
+static ImVector<ImDrawIdx>      g_MergedIdxBuffer;
+static ImVector<unsigned int>   g_MergedIdxBuffer32;
+static ImVector<ImDrawCmd>      g_MergedCmds;
+static bool                     g_MergedBuffersVerified = false;
+
+static void InitMergeBuffers(const BenchOptions&)
+{
+    g_MergedBuffersVerified = false;
+    for (int n = 0; n < 3; n++)
+    {
+        ImGui::NewFrame();
+        FrameDashboard(false);
+        ImGui::ShowDemoWindow(NULL);
+        ImGui::Render();
+    }
+}
+
+static void BenchVerifyMergedBuffers(const ImDrawData* draw_data, bool idx32)
+{
+    int mismatches = 0, merged_cmd_n = 0;
+    for (int cmd_list_n = 0; cmd_list_n < draw_data->CmdListsCount; cmd_list_n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[cmd_list_n];
+        for (int cmd_n = 0; cmd_n < cmd_list->CmdBuffer.Size; cmd_n++, merged_cmd_n++)
+        {
+            const ImDrawCmd& src_cmd = cmd_list->CmdBuffer[cmd_n];
+            const ImDrawCmd& dst_cmd = g_MergedCmds[merged_cmd_n];
+            if (src_cmd.ElemCount != dst_cmd.ElemCount || src_cmd.TextureId != dst_cmd.TextureId)
+            {
+                mismatches++;
+                continue;
+            }
+            for (unsigned int elem_n = 0; elem_n < src_cmd.ElemCount; elem_n++)
+            {
+                const ImDrawVert& src_vtx = cmd_list->VtxBuffer[src_cmd.VtxOffset + cmd_list->IdxBuffer[src_cmd.IdxOffset + elem_n]];
+                const unsigned int dst_idx = idx32 ? g_MergedIdxBuffer32[dst_cmd.IdxOffset + elem_n] : g_MergedIdxBuffer[dst_cmd.IdxOffset + elem_n];
+                if (memcmp(&src_vtx, &g_MergedVtxBuffer[dst_cmd.VtxOffset + dst_idx], sizeof(ImDrawVert)) != 0)
+                    mismatches++;
+            }
+        }
+    }
+    BenchSetExtraValue("mismatches", mismatches + (merged_cmd_n != g_MergedCmds.Size ? 1 : 0));
+}
+
+static void FrameMergeBuffers(bool idx32)
+{
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    g_MergedVtxBuffer.resize(draw_data->TotalVtxCount);
+    if (idx32)
+    {
+        g_MergedIdxBuffer32.resize(draw_data->TotalIdxCount);
+        draw_data->MergeBuffersIdx32(g_MergedVtxBuffer.Data, g_MergedIdxBuffer32.Data, &g_MergedCmds);
+    }
+    else
+    {
+        g_MergedIdxBuffer.resize(draw_data->TotalIdxCount);
+        draw_data->MergeBuffers(g_MergedVtxBuffer.Data, g_MergedIdxBuffer.Data, &g_MergedCmds);
+    }
+    if (!g_MergedBuffersVerified)
+    {
+        BenchVerifyMergedBuffers(draw_data, idx32);
+        g_MergedBuffersVerified = true;
+    }
+    BenchSetExtraValue("cmd_lists", draw_data->CmdListsCount);
+    BenchSetExtraValue("merged_cmds", g_MergedCmds.Size);
+    BenchSetExtraValue("vertices", draw_data->TotalVtxCount);
+}
+static void FrameMergeBuffers(const BenchOptions&)      { FrameMergeBuffers(false); }
+static void FrameMergeBuffersIdx32(const BenchOptions&) { FrameMergeBuffers(true); }
+
+static void ShutdownMergeBuffers()
+{
+    g_MergedVtxBuffer.clear();
+    g_MergedIdxBuffer.clear();
+    g_MergedIdxBuffer32.clear();
+    g_MergedCmds.clear();
+}
+
+// ImGuiTextLog: 1M lines, displayed unfiltered or with a filter matching 1 line out of 1000
+static const int        BENCH_TEXT_LOG_LINES = 1000000;
+static ImGuiTextLog*    g_TextLog = NULL;
+static ImGuiTextFilter  g_TextLogFilter;
+
+static void InitTextLog(const BenchOptions&)
+{
+    g_TextLog = IM_NEW(ImGuiTextLog)();
+    g_TextLog->AutoScroll = false;
+    g_TextLog->FilterLinesPerFrame = 0; // Build the filtered index in the first (warmup) frame
+    for (int n = 0; n < BENCH_TEXT_LOG_LINES; n++)
+        g_TextLog->Appendf("[%07d] [%s] Request served in %d us\n", n, (n % 1000) ? "info" : "error", (n * 37) % 1000);
+    strcpy(g_TextLogFilter.InputBuf, "error");
+    g_TextLogFilter.Build();
+}
+static void FrameTextLog(bool filter, bool cached)
+{
+    if (BeginBenchWindow("TextLog"))
+    {
+        if (cached)
+        {
+            g_TextLog->Draw("##log", filter ? &g_TextLogFilter : NULL);
+        }
+        else
+        {
+            // Scan every line every frame (what ExampleAppLog used to do when filtering)
+            ImGui::BeginChild("##log");
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            for (int line_no = 0; line_no < g_TextLog->GetLineCount(); line_no++)
+                if (g_TextLogFilter.PassFilter(g_TextLog->GetLineBegin(line_no), g_TextLog->GetLineEnd(line_no)))
+                    ImGui::TextUnformatted(g_TextLog->GetLineBegin(line_no), g_TextLog->GetLineEnd(line_no));
+            ImGui::PopStyleVar();
+            ImGui::EndChild();
+        }
+    }
+    ImGui::End();
+}
+static void FrameTextLog(const BenchOptions&)           { FrameTextLog(false, true); }
+static void FrameTextLogFilter(const BenchOptions&)     { FrameTextLog(true, true); }
+static void FrameTextLogFilterScan(const BenchOptions&) { FrameTextLog(true, false); }
+static void ShutdownTextLog()
+{
+    IM_DELETE(g_TextLog);
+    g_TextLog = NULL;
+    g_TextLogFilter.Clear();
+}
+
+// ImGuiTextLog ingestion: 10000 lines per frame into a log bounded to 4 MB, appended directly or through the lock-free queue
+static void InitTextLogIngest(const BenchOptions&)
+{
+    g_TextLog = IM_NEW(ImGuiTextLog)();
+    g_TextLog->MaxSize = 4 * 1024 * 1024;
+    g_TextLog->SetQueueSize(1024 * 1024);
+}
+static void FrameTextLogIngest(bool queue)
+{
+    const int frame_count = ImGui::GetFrameCount();
+    for (int n = 0; n < 10000; n++)
+    {
+        if (queue)
+            g_TextLog->Pushf("[%05d] [info] Request %d served in %d us\n", frame_count, n, (n * 37) % 1000);
+        else
+            g_TextLog->Appendf("[%05d] [info] Request %d served in %d us\n", frame_count, n, (n * 37) % 1000);
+    }
+    if (BeginBenchWindow("TextLog"))
+        g_TextLog->Draw("##log");
+    ImGui::End();
+    BenchSetExtraValue("log_lines", g_TextLog->GetLineCount());
+    BenchSetExtraValue("dropped", (int)g_TextLog->QueueDroppedCount);
+}
+static void FrameTextLogAppend(const BenchOptions&)     { FrameTextLogIngest(false); }
+static void FrameTextLogQueue(const BenchOptions&)      { FrameTextLogIngest(true); }
+
+// ImGuiTextBuffer: appendf() 200000 lines into an empty buffer, and display 1M lines (40 MB) with TextUnformatted()
+static ImGuiTextBuffer* g_TextBuffer = NULL;
+
+static void FrameTextBufferAppend(int chunk_size)
+{
+    ImGuiTextBuffer buf;
+    buf.ChunkSize = chunk_size;
+    for (int n = 0; n < 200000; n++)
+        buf.appendf("[%07d] [info] Request served in %d us\n", n, (n * 37) % 1000);
+    BenchSetExtraValue("size", buf.size());
+}
+static void FrameTextBufferAppend(const BenchOptions&)          { FrameTextBufferAppend(0); }
+static void FrameTextBufferAppendChunked(const BenchOptions&)   { FrameTextBufferAppend(1024 * 1024); }
+
+static void InitTextBufferDisplay(int chunk_size)
+{
+    g_TextBuffer = IM_NEW(ImGuiTextBuffer)();
+    g_TextBuffer->ChunkSize = chunk_size;
+    for (int n = 0; n < 1000000; n++)
+        g_TextBuffer->appendf("[%07d] [info] Request served in %d us\n", n, (n * 37) % 1000);
+}
+static void InitTextBufferDisplay(const BenchOptions&)          { InitTextBufferDisplay(0); }
+static void InitTextBufferDisplayChunked(const BenchOptions&)   { InitTextBufferDisplay(1024 * 1024); }
+static void FrameTextBufferDisplay(const BenchOptions&)
+{
+    if (BeginBenchWindow("TextBuffer"))
+    {
+        ImGui::SetScrollY(ImGui::GetScrollMaxY() * 0.5f);
+        ImGui::TextUnformattedBuffer(g_TextBuffer);
+    }
+    ImGui::End();
+}
+static void ShutdownTextBufferDisplay()
+{
+    IM_DELETE(g_TextBuffer);
+    g_TextBuffer = NULL;
+}
+
+// 4 MB of word-wrapped paragraphs
+static void InitTextWrapped(const BenchOptions&)
+{
+    g_TextBuffer = IM_NEW(ImGuiTextBuffer)();
+    for (int n = 0; g_TextBuffer->size() < 4 * 1024 * 1024; n++)
+        g_TextBuffer->appendf("Paragraph %d: the quick brown fox jumps over the lazy dog, lorem ipsum dolor sit amet, consectetur adipiscing elit.%s", n, (n % 5 == 4) ? "\n\n" : " ");
+}
+static void FrameTextWrapped(const BenchOptions&)
+{
+    if (BeginBenchWindow("TextWrapped"))
+    {
+        ImGui::SetScrollY(ImGui::GetScrollMaxY() * 0.5f);
+        ImGui::PushTextWrapPos(0.0f);
+        ImGui::TextUnformatted(g_TextBuffer->begin(), g_TextBuffer->end());
+        ImGui::PopTextWrapPos();
+    }
+    ImGui::End();
+}
+static void FrameTextWrappedVersioned(const BenchOptions&)
+{
+    if (BeginBenchWindow("TextWrapped"))
+    {
+        ImGui::SetScrollY(ImGui::GetScrollMaxY() * 0.5f);
+        ImGui::PushTextWrapPos(0.0f);
+        ImGui::SetNextItemTextVersion(1); // Never modified
+        ImGui::TextUnformatted(g_TextBuffer->begin(), g_TextBuffer->end());
+        ImGui::PopTextWrapPos();
+    }
+    ImGui::End();
+}
+static void FrameTextWrappedResize(const BenchOptions&)
+{
+    if (BeginBenchWindow("TextWrapped"))
+    {
+        ImGui::PushTextWrapPos(ImGui::GetContentRegionAvail().x * (0.5f + 0.5f * (ImGui::GetFrameCount() % 10) / 10.0f));
+        ImGui::TextUnformatted(g_TextBuffer->begin(), g_TextBuffer->end());
+        ImGui::PopTextWrapPos();
+    }
+    ImGui::End();
+}
+
+// 256 MB log file (6.1M lines), error lines every 1000 lines
+// Indexing and searching run on background threads: we wait for them in Init() and in the first (warmup) frame, and report their duration.
+static const char*      g_FileViewerFilename = "example_null_benchmark_file_viewer.log";
+static ImGuiFileViewer* g_FileViewer = NULL;
+static ImGuiTextFilter* g_FileViewerFilter = NULL;
+static double           g_FileViewerIndexMs = 0.0;
+static double           g_FileViewerSearchMs = -1.0;
+static void InitFileViewer(const char* filter)
+{
+    g_FileViewer = IM_NEW(ImGuiFileViewer)();
+    g_FileViewerFilter = IM_NEW(ImGuiTextFilter)(filter);
+    FILE* f = fopen(g_FileViewerFilename, "wb");
+    if (!f)
+        return;
+    char line[128];
+    for (int n = 0; ftell(f) < 256 * 1024 * 1024; n++)
+    {
+        int len = snprintf(line, sizeof(line), "[%09d] [%s] Request served in %3d us\n", n, (n % 1000 == 999) ? "error" : "info", (n * 37) % 1000);
+        fwrite(line, 1, (size_t)len, f);
+    }
+    fclose(f);
+    BenchClock::time_point t0 = BenchClock::now();
+    if (!g_FileViewer->Open(g_FileViewerFilename))
+        return;
+    while (g_FileViewer->IsIndexing())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    g_FileViewerIndexMs = BenchElapsedMs(t0, BenchClock::now());
+    g_FileViewerSearchMs = -1.0;
+}
+static void InitFileViewer(const BenchOptions&)        { InitFileViewer(""); }
+static void InitFileViewerFilter(const BenchOptions&)  { InitFileViewer("error"); }
+static void FrameFileViewer(const BenchOptions&)
+{
+    if (BeginBenchWindow("FileViewer"))
+    {
+        if (!g_FileViewerFilter->IsActive())
+            g_FileViewer->FirstLine = g_FileViewer->GetLineCount() / 2;
+        g_FileViewer->Draw("##viewer", g_FileViewerFilter);
+    }
+    ImGui::End();
+    if (g_FileViewerSearchMs < 0.0)
+    {
+        BenchClock::time_point t0 = BenchClock::now();
+        while (g_FileViewer->IsSearching())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        g_FileViewerSearchMs = BenchElapsedMs(t0, BenchClock::now());
+    }
+    BenchSetExtraValue("lines", (double)g_FileViewer->GetLineCount());
+    BenchSetExtraValue("index_ms", g_FileViewerIndexMs);
+    if (g_FileViewerFilter->IsActive())
+        BenchSetExtraValue("search_ms", g_FileViewerSearchMs);
+}
+static void ShutdownFileViewer()
+{
+    IM_DELETE(g_FileViewer);
+    IM_DELETE(g_FileViewerFilter);
+    g_FileViewer = NULL;
+    g_FileViewerFilter = NULL;
+    remove(g_FileViewerFilename);
+}
+
+static ImVector<float> g_PlotValues;
+static void InitPlotLines(const BenchOptions&)
+{
+    g_PlotValues.resize(1000000);
+    for (int n = 0; n < g_PlotValues.Size; n++)
+        g_PlotValues[n] = sinf(n * 0.001f) + cosf(n * 0.013f) * 0.25f;
+}
+static void FramePlotLines(const BenchOptions&)
+{
+    if (BeginBenchWindow("PlotLines"))
+        ImGui::PlotLines("##plot", g_PlotValues.Data, g_PlotValues.Size, 0, "1M samples", FLT_MAX, FLT_MAX, ImVec2(-1.0f, 400.0f));
+    ImGui::End();
+}
+static void ShutdownPlotLines()
+{
+    g_PlotValues.clear();
+}
+
+// Polylines: oscilloscope-like trace of 96000 points in a standalone ImDrawList, submitted as 6 polylines which fit in 16-bit indices
+static const int        BENCH_POLYLINE_POINTS = 96000;
+static const int        BENCH_POLYLINE_CHUNK = 16000;
+static ImVector<ImVec2> g_PolylinePoints;
+static ImDrawList*      g_PolylineDrawList = NULL;
+
+static void InitPolyline(const BenchOptions&)
+{
+    g_PolylinePoints.resize(BENCH_POLYLINE_POINTS);
+    for (int n = 0; n < g_PolylinePoints.Size; n++)
+        g_PolylinePoints[n] = ImVec2(n * (1920.0f / BENCH_POLYLINE_POINTS), 540.0f + sinf(n * 0.05f) * 300.0f + sinf(n * 1.7f) * 20.0f);
+    g_PolylineDrawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+}
+static void FramePolyline(ImDrawListFlags flags, float thickness)
+{
+    ImDrawList* draw_list = g_PolylineDrawList;
+    draw_list->Clear();
+    draw_list->Flags = flags | ImDrawListFlags_AllowVtxOffset;
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->PushClipRectFullScreen();
+    for (int n = 0; n < g_PolylinePoints.Size - 1; n += BENCH_POLYLINE_CHUNK - 1)
+    {
+        const int points_count = (g_PolylinePoints.Size - n < BENCH_POLYLINE_CHUNK) ? g_PolylinePoints.Size - n : BENCH_POLYLINE_CHUNK;
+        draw_list->AddPolyline(g_PolylinePoints.Data + n, points_count, IM_COL32(0, 255, 0, 255), false, thickness);
+    }
+    BenchSetExtraValue("vertices", draw_list->VtxBuffer.Size);
+    BenchSetExtraValue("indices", draw_list->IdxBuffer.Size);
+}
+static void FramePolylineAA(const BenchOptions&)        { FramePolyline(ImDrawListFlags_AntiAliasedLines, 1.0f); }
+static void FramePolylineAAThick(const BenchOptions&)   { FramePolyline(ImDrawListFlags_AntiAliasedLines, 3.0f); }
+static void FramePolylineNoAA(const BenchOptions&)      { FramePolyline(ImDrawListFlags_None, 1.0f); }
+static void ShutdownPolyline()
+{
+    IM_DELETE(g_PolylineDrawList);
+    g_PolylineDrawList = NULL;
+    g_PolylinePoints.clear();
+}
+
+// Batches: heatmap (rectangles) and scatter plot (circles) of 100000 elements, all visible (so culling doesn't skew the comparison)
+static const int        BENCH_BATCH_COUNT = 100000;
+static ImVector<ImVec2> g_BatchRects;
+static ImVector<ImVec2> g_BatchCentres;
+static ImVector<float>  g_BatchRadii;
+static ImVector<ImU32>  g_BatchColors;
+
+static void InitBatch(const BenchOptions& opts)
+{
+    InitPolyline(opts);
+    g_BatchRects.resize(BENCH_BATCH_COUNT * 2);
+    g_BatchCentres.resize(BENCH_BATCH_COUNT);
+    g_BatchRadii.resize(BENCH_BATCH_COUNT);
+    g_BatchColors.resize(BENCH_BATCH_COUNT);
+    for (int n = 0; n < BENCH_BATCH_COUNT; n++)
+    {
+        const float x = (float)(n % 400) * 4.8f, y = (float)(n / 400) * 4.3f;   // 400x250 cells of 4.8x4.3 in the 1920x1080 display
+        g_BatchRects[n * 2 + 0] = ImVec2(x, y);
+        g_BatchRects[n * 2 + 1] = ImVec2(x + 4.5f, y + 4.0f);
+        g_BatchCentres[n] = ImVec2(x + 3.0f, y + sinf(n * 0.37f) * 2.0f);
+        g_BatchRadii[n] = 2.0f + (float)(n % 3);
+        g_BatchColors[n] = IM_COL32(n % 256, (n / 256) % 256, 128, 255);
+    }
+}
+static void FrameBatch(bool circles, bool batch)
+{
+    ImDrawList* draw_list = g_PolylineDrawList;
+    draw_list->Clear();
+    draw_list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->PushClipRectFullScreen();
+    if (circles && batch)
+        draw_list->AddCircleFilledBatch(g_BatchCentres.Data, g_BatchRadii.Data, g_BatchColors.Data, BENCH_BATCH_COUNT, 8);
+    else if (circles)
+        for (int n = 0; n < BENCH_BATCH_COUNT; n++)
+            draw_list->AddCircleFilled(g_BatchCentres[n], g_BatchRadii[n], g_BatchColors[n], 8);
+    else if (batch)
+        draw_list->AddRectFilledBatch(g_BatchRects.Data, g_BatchColors.Data, BENCH_BATCH_COUNT);
+    else
+        for (int n = 0; n < BENCH_BATCH_COUNT; n++)
+            draw_list->AddRectFilled(g_BatchRects[n * 2], g_BatchRects[n * 2 + 1], g_BatchColors[n]);
+    BenchSetExtraValue("vertices", draw_list->VtxBuffer.Size);
+}
+static void FrameRectsSingle(const BenchOptions&)       { FrameBatch(false, false); }
+static void FrameRectsBatch(const BenchOptions&)        { FrameBatch(false, true); }
+static void FrameCirclesSingle(const BenchOptions&)     { FrameBatch(true, false); }
+static void FrameCirclesBatch(const BenchOptions&)      { FrameBatch(true, true); }
+static void ShutdownBatch()
+{
+    ShutdownPolyline();
+    g_BatchRects.clear();
+    g_BatchCentres.clear();
+    g_BatchRadii.clear();
+    g_BatchColors.clear();
+}
+
+// Node graph pins: 20000 small filled circles with an outline, plus 100 large circles, all with the default (automatic) segment count
+static void FrameCirclesPins(const BenchOptions&)
+{
+    ImDrawList* draw_list = g_PolylineDrawList;
+    draw_list->Clear();
+    draw_list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->PushClipRectFullScreen();
+    for (int n = 0; n < 20000; n++)
+    {
+        draw_list->AddCircleFilled(g_BatchCentres[n * 5], 4.0f + (float)(n % 3), g_BatchColors[n]);
+        draw_list->AddCircle(g_BatchCentres[n * 5], 4.0f + (float)(n % 3), IM_COL32_WHITE);
+    }
+    for (int n = 0; n < 100; n++)
+        draw_list->AddCircle(ImVec2(960.0f, 540.0f), 100.0f + n * 4.0f, g_BatchColors[n]);
+    BenchSetExtraValue("vertices", draw_list->VtxBuffer.Size);
+}
+
+// Node graph pins as a composite shape (filled circle, outline, arrow) drawn 20000 times, either directly or replayed from a ImDrawStamp
+// The stamp is recorded from the first pin every frame, as an application would do.
+static void DrawPinShape(ImDrawList* draw_list, const ImVec2& p, ImU32 col)
+{
+    draw_list->AddCircleFilled(p, 4.0f, col);
+    draw_list->AddCircle(p, 4.0f, IM_COL32(200, 200, 200, 255), 0, 1.5f);
+    draw_list->AddTriangleFilled(ImVec2(p.x + 6.0f, p.y - 3.0f), ImVec2(p.x + 10.0f, p.y), ImVec2(p.x + 6.0f, p.y + 3.0f), col);
+}
+static void FramePinShapes(int mode)
+{
+    const int PINS_COUNT = 20000;
+    ImDrawList* draw_list = g_PolylineDrawList;
+    draw_list->Clear();
+    draw_list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->PushClipRectFullScreen();
+    if (mode == 0)
+    {
+        for (int n = 0; n < PINS_COUNT; n++)
+            DrawPinShape(draw_list, g_BatchCentres[n], g_BatchColors[n]);
+    }
+    else
+    {
+        static ImDrawStamp stamp;
+        stamp.RecordBegin(draw_list);
+        DrawPinShape(draw_list, g_BatchCentres[0], IM_COL32_WHITE);
+        stamp.RecordEnd(draw_list, g_BatchCentres[0]);
+        if (mode == 1)
+            for (int n = 1; n < PINS_COUNT; n++)
+                draw_list->AddStamp(stamp, g_BatchCentres[n], g_BatchColors[n]);
+        else
+            draw_list->AddStampBatch(stamp, g_BatchCentres.Data + 1, g_BatchColors.Data + 1, PINS_COUNT - 1);
+    }
+    BenchSetExtraValue("vertices", draw_list->VtxBuffer.Size);
+}
+static void FramePinShapesDirect(const BenchOptions&)   { FramePinShapes(0); }
+static void FramePinShapesStamp(const BenchOptions&)    { FramePinShapes(1); }
+static void FramePinShapesStampBatch(const BenchOptions&) { FramePinShapes(2); }
+
+// Canvas: 20000 nodes (rectangle, outline, text, pins, link) on a 10x larger virtual canvas, so ~90% of them are outside of the clipping rectangle
+static void FrameCanvas(ImDrawListFlags extra_flags)
+{
+    ImDrawList* draw_list = g_PolylineDrawList;
+    draw_list->Clear();
+    draw_list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset | extra_flags;
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->PushClipRect(ImVec2(0.0f, 0.0f), ImVec2(1920.0f, 1080.0f));
+    ImFont* font = ImGui::GetIO().Fonts->Fonts[0]; // Not using the default font of the draw list: NoFrame scenarios run outside of NewFrame()/Render()
+    for (int n = 0; n < 20000; n++)
+    {
+        const ImVec2 p((float)(n % 200) * 30.0f, (float)(n / 200) * 33.0f);
+        draw_list->AddRectFilled(p, ImVec2(p.x + 26.0f, p.y + 28.0f), IM_COL32(60, 60, 70, 255), 4.0f);
+        draw_list->AddRect(p, ImVec2(p.x + 26.0f, p.y + 28.0f), IM_COL32(200, 200, 200, 255), 4.0f);
+        draw_list->AddText(font, font->FontSize, ImVec2(p.x + 2.0f, p.y + 2.0f), IM_COL32_WHITE, "Node");
+        draw_list->AddCircleFilled(ImVec2(p.x, p.y + 20.0f), 3.0f, IM_COL32(255, 200, 0, 255));
+        draw_list->AddBezierCurve(ImVec2(p.x + 26.0f, p.y + 20.0f), ImVec2(p.x + 40.0f, p.y + 20.0f), ImVec2(p.x + 16.0f, p.y + 53.0f), ImVec2(p.x + 30.0f, p.y + 53.0f), IM_COL32(255, 200, 0, 255), 1.0f);
+    }
+    BenchSetExtraValue("vertices", draw_list->VtxBuffer.Size);
+    BenchSetExtraValue("prims_emitted", draw_list->PrimEmittedCount);
+    BenchSetExtraValue("prims_culled", draw_list->PrimCulledCount);
+}
+static void FrameCanvasNoCulling(const BenchOptions&)   { FrameCanvas(ImDrawListFlags_None); }
+static void FrameCanvasCulling(const BenchOptions&)     { FrameCanvas(ImDrawListFlags_CoarseCulling); }
+
+// ID hashing: GetID() over label corpora resembling real applications (compare builds with and without IMGUI_USE_FAST_HASH)
+// Collisions are counted within each corpus (same ID stack) and compared to the expected count for a perfect 32-bit hash.
+struct BenchLabelCorpus
+{
+    const char*     Name;
+    ImVector<char>  Buf;                                // Zero-terminated labels
+    ImVector<int>   Offsets;                            // Offset of each label in Buf (empty for the pointers corpus)
+    ImVector<ImGuiID> Ids;
+};
+static const int        BENCH_CORPUS_SIZE = 50000;
+static BenchLabelCorpus g_LabelCorpora[5];
+
+static void InitHashIds(const BenchOptions&)
+{
+    const char* names[] = { "short", "hidden", "triple_hash", "long", "pointers" };
+    for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(g_LabelCorpora); corpus_n++)
+    {
+        BenchLabelCorpus& corpus = g_LabelCorpora[corpus_n];
+        corpus.Name = names[corpus_n];
+        corpus.Ids.resize(BENCH_CORPUS_SIZE);
+        for (int n = 0; n < BENCH_CORPUS_SIZE && corpus_n != 4; n++)
+        {
+            char label[128];
+            switch (corpus_n)
+            {
+            case 0: sprintf(label, "Button %d", n); break;
+            case 1: sprintf(label, "Item %d##list", n); break;
+            case 2: sprintf(label, "Frame %d (%d fps)###Stats%d", n / 7, n % 60, n); break;
+            case 3: sprintf(label, "Some longer label for entry number %d, as found in lists and trees", n); break;
+            }
+            const int label_size = (int)strlen(label) + 1;
+            corpus.Offsets.push_back(corpus.Buf.Size);
+            corpus.Buf.resize(corpus.Buf.Size + label_size);
+            memcpy(corpus.Buf.Data + corpus.Offsets.back(), label, (size_t)label_size);
+        }
+    }
+}
+static void FrameHashIds(const BenchOptions&)
+{
+    if (BeginBenchWindow("HashIds"))
+    {
+        for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(g_LabelCorpora); corpus_n++)
+        {
+            BenchLabelCorpus& corpus = g_LabelCorpora[corpus_n];
+            ImGuiID* ids = corpus.Ids.Data;
+            if (corpus.Offsets.empty())
+                for (int n = 0; n < BENCH_CORPUS_SIZE; n++)
+                    ids[n] = ImGui::GetID((const void*)(intptr_t)(0x10000 + n * 16));
+            else
+                for (int n = 0; n < BENCH_CORPUS_SIZE; n++)
+                    ids[n] = ImGui::GetID(corpus.Buf.Data + corpus.Offsets[n]);
+        }
+    }
+    ImGui::End();
+}
+static int BenchCompareIds(const void* lhs, const void* rhs)
+{
+    const ImGuiID a = *(const ImGuiID*)lhs, b = *(const ImGuiID*)rhs;
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+static void ShutdownHashIds()
+{
+    static char value_names[IM_ARRAYSIZE(g_LabelCorpora)][64];
+    for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(g_LabelCorpora); corpus_n++)
+    {
+        BenchLabelCorpus& corpus = g_LabelCorpora[corpus_n];
+        qsort(corpus.Ids.Data, (size_t)corpus.Ids.Size, sizeof(ImGuiID), BenchCompareIds);
+        int collisions = 0;
+        for (int n = 1; n < corpus.Ids.Size; n++)
+            if (corpus.Ids[n] == corpus.Ids[n - 1])
+                collisions++;
+        sprintf(value_names[corpus_n], "collisions_%s", corpus.Name);
+        BenchSetExtraValue(value_names[corpus_n], collisions);
+        corpus.Buf.clear();
+        corpus.Offsets.clear();
+        corpus.Ids.clear();
+    }
+    BenchSetExtraValue("collisions_expected_per_corpus", (double)BENCH_CORPUS_SIZE * (BENCH_CORPUS_SIZE - 1) * 0.5 / 4294967296.0);
+    BenchSetExtraValue("ids_per_frame", (double)BENCH_CORPUS_SIZE * IM_ARRAYSIZE(g_LabelCorpora));
+}
+
+// Literal labels: GetID("...") hashes the string every time, GetID(IM_HASHED_LABEL("...")) only combines a precomputed hash with the ID stack.
+// The first frame of 'ids_hashed_literal' checks that both give the same IDs, including "##", "###" and nested PushID() of hashed labels.
+#define BENCH_LITERAL_LABELS(X) \
+    X("") X("OK") X("Settings") X("Rendering##Tab") X("Frame Statistics###Stats") X("###Popup") X("####") \
+    X("Some longer label, as found in menus, lists and trees") X("Label with an UTF-8 \xE2\x9C\x93 check mark")
+static const int    BENCH_LITERAL_SEEDS = 5000;
+static bool         g_LiteralLabelsVerified = false;
+
+static void BenchVerifyHashedLabels()
+{
+    int mismatches = 0, compared = 0;
+#define BENCH_COMPARE(_LABEL)   { mismatches += (ImGui::GetID(_LABEL) != ImGui::GetID(IM_HASHED_LABEL(_LABEL))) ? 1 : 0; compared++; }
+#define BENCH_NESTED(_LABEL)    { ImGui::PushID(_LABEL); const ImGuiID a = ImGui::GetID("Child"); ImGui::PopID(); ImGui::PushID(IM_HASHED_LABEL(_LABEL)); const ImGuiID b = ImGui::GetID("Child"); ImGui::PopID(); mismatches += (a != b) ? 1 : 0; compared++; }
+    for (int n = 0; n < BENCH_LITERAL_SEEDS; n++)
+    {
+        ImGui::PushID(n);
+        BENCH_LITERAL_LABELS(BENCH_COMPARE)
+        BENCH_LITERAL_LABELS(BENCH_NESTED)
+        ImGui::PopID();
+    }
+    BENCH_LITERAL_LABELS(BENCH_COMPARE) // Window seed
+#undef BENCH_COMPARE
+#undef BENCH_NESTED
+    BenchSetExtraValue("verified_ids", compared);
+    BenchSetExtraValue("mismatches", mismatches);
+}
+
+static void FrameIdsLiteral(bool hashed)
+{
+    if (BeginBenchWindow("IdsLiteral"))
+    {
+        if (hashed && !g_LiteralLabelsVerified)
+        {
+            BenchVerifyHashedLabels();
+            g_LiteralLabelsVerified = true;
+        }
+        ImGuiID checksum = 0;
+#define BENCH_GET_ID(_LABEL)        checksum += ImGui::GetID(_LABEL);
+#define BENCH_GET_ID_HASHED(_LABEL) checksum += ImGui::GetID(IM_HASHED_LABEL(_LABEL));
+        for (int n = 0; n < BENCH_LITERAL_SEEDS; n++)
+        {
+            ImGui::PushID(n);
+            if (hashed)
+                { BENCH_LITERAL_LABELS(BENCH_GET_ID_HASHED) }
+            else
+                { BENCH_LITERAL_LABELS(BENCH_GET_ID) }
+            ImGui::PopID();
+        }
+#undef BENCH_GET_ID
+#undef BENCH_GET_ID_HASHED
+        BenchSetExtraValue("checksum", checksum);
+    }
+    ImGui::End();
+}
+static void InitIdsHashedLiteral(const BenchOptions&)   { g_LiteralLabelsVerified = false; }
+static void FrameIdsLiteral(const BenchOptions&)        { FrameIdsLiteral(false); }
+static void FrameIdsHashedLiteral(const BenchOptions&)  { FrameIdsLiteral(true); }
+
+// ImGuiStorage: insertions in random order (e.g. first frame of a large tree), and lookups (every frame)
+static const int        BENCH_STORAGE_SIZE = 10000;
+static ImGuiStorage     g_Storage;
+static ImVector<ImGuiID> g_StorageKeys;
+
+static void InitStorage(const BenchOptions&)
+{
+    g_StorageKeys.resize(BENCH_STORAGE_SIZE * 5);
+    ImU32 key = 0x12345678;
+    for (int n = 0; n < g_StorageKeys.Size; n++)
+        g_StorageKeys[n] = key = key * 1664525u + 1013904223u;
+    for (int n = 0; n < g_StorageKeys.Size; n++)
+        g_Storage.SetInt(g_StorageKeys[n], n);
+}
+static void FrameStorageInsert(const BenchOptions&)
+{
+    ImGuiStorage storage;
+    for (int n = 0; n < BENCH_STORAGE_SIZE; n++)
+        storage.SetInt(g_StorageKeys[n], n);
+}
+static void FrameStorageLookup(const BenchOptions&)
+{
+    int sum = 0;
+    for (int n = 0; n < g_StorageKeys.Size; n++)
+        sum += g_Storage.GetInt(g_StorageKeys[n] ^ (n & 1)); // Half of the queries miss
+    BenchSetExtraValue("checksum", sum);
+}
+static void ShutdownStorage()
+{
+    g_Storage.Clear();
+    g_StorageKeys.clear();
+}
+
+// ImFontAtlas::ParallelForFn implementation: every thread picks the next job index until all are done
+static void BenchParallelFor(void (*job_fn)(void* job_data, int job_index), void* job_data, int jobs_count, void* user_data)
+{
+    const int threads_count = *(const int*)user_data;
+    std::atomic<int> next_job(0);
+    std::vector<std::thread> threads;
+    for (int thread_n = 0; thread_n < threads_count - 1; thread_n++)
+        threads.push_back(std::thread([&]() { for (int job_n; (job_n = next_job++) < jobs_count; ) job_fn(job_data, job_n); }));
+    for (int job_n; (job_n = next_job++) < jobs_count; )
+        job_fn(job_data, job_n);
+    for (size_t thread_n = 0; thread_n < threads.size(); thread_n++)
+        threads[thread_n].join();
+}
+
+static const char* g_FontAtlasCacheFilename = "example_null_benchmark_atlas.cache";
+
+static void BuildFontAtlasCJK(const BenchOptions& opts, ImFontAtlasFlags flags, const char* cache_filename = NULL, bool multi_threaded = false)
+{
+    ImFontAtlas atlas;
+    atlas.Flags |= flags;
+    atlas.CacheFilename = cache_filename;
+    if (multi_threaded)
+    {
+        atlas.ParallelForFn = BenchParallelFor;
+        atlas.ParallelForUserData = (void*)&opts.Threads;
+    }
+    ImFontConfig font_cfg;
+    font_cfg.OversampleH = 1;
+    ImFont* font = atlas.AddFontFromFileTTF(opts.CjkFontFilename, 16.0f, &font_cfg, atlas.GetGlyphRangesChineseFull());
+    if (!font)
+    {
+        fprintf(stderr, "Failed to load '%s'\n", opts.CjkFontFilename);
+        exit(1);
+    }
+    atlas.Build();
+    if (!font->HasGlyph(0x4E00))
+    {
+        fprintf(stderr, "'%s' has no CJK glyphs (U+4E00 not found), measuring it would be meaningless\n", opts.CjkFontFilename);
+        exit(1);
+    }
+
+    // With ImFontAtlasFlags_DynamicGlyphs, include the cost of rasterizing what a typical screen would display
+    if (flags & ImFontAtlasFlags_DynamicGlyphs)
+        for (ImWchar c = 0x4E00; c < 0x4E00 + 500; c++)
+            font->FindGlyph(c);
+}
+
+static void FrameFontAtlasCJK(const BenchOptions& opts)           { BuildFontAtlasCJK(opts, ImFontAtlasFlags_None); }
+static void FrameFontAtlasCJKDynamic(const BenchOptions& opts)    { BuildFontAtlasCJK(opts, ImFontAtlasFlags_DynamicGlyphs); }
+static void FrameFontAtlasCJKThreaded(const BenchOptions& opts)   { BuildFontAtlasCJK(opts, ImFontAtlasFlags_None, NULL, true); }
+static void InitFontAtlasCJKCached(const BenchOptions&)            { remove(g_FontAtlasCacheFilename); }
+static void FrameFontAtlasCJKCached(const BenchOptions& opts)     { BuildFontAtlasCJK(opts, ImFontAtlasFlags_None, g_FontAtlasCacheFilename); }  // First (warmup) build writes the cache file
+static void ShutdownFontAtlasCJKCached()                          { remove(g_FontAtlasCacheFilename); }
+
+static const BenchScenario g_Scenarios[] =
+{
+    { "demo_window",            "ShowDemoWindow()",                                 NULL, FrameDemoWindow, NULL, false },
+    { "text_10k",               "10000 lines of TextUnformatted()",                 NULL, FrameTextLines, NULL, false },
+    { "tree_nodes_collapsed",   "1000 collapsed TreeNode()",                        NULL, FrameTreeNodesCollapsed, NULL, false },
+    { "tree_nodes_expanded",    "1000 expanded TreeNode()",                         NULL, FrameTreeNodesExpanded, NULL, false },
+    { "columns_dense",          "12 columns x 400 rows of Text()",                  NULL, FrameColumns, NULL, false },
+    { "labels_static",          "1000 Button() + 1000 Selectable() with unchanging labels", NULL, FrameLabelsStatic, NULL, false },
+    { "dashboard",              "48 static panels with text, plots and buttons",    NULL, FrameDashboard, NULL, false },
+    { "dashboard_reuse",        "Same with SetNextWindowContentHash()",             NULL, FrameDashboardReuse, NULL, false },
+    { "dashboard_damage",       "Same with io.ConfigDrawDataDamageRects, one panel changing every frame", InitDashboardDamage, FrameDashboardDamage, NULL, false },
+    { "merge_buffers",          "ImDrawData::MergeBuffers() on the dashboard + demo window draw data", InitMergeBuffers, FrameMergeBuffers, ShutdownMergeBuffers, true },
+    { "merge_buffers_idx32",    "Same with MergeBuffersIdx32()",                    InitMergeBuffers, FrameMergeBuffersIdx32, ShutdownMergeBuffers, true },
+    { "hash_ids",               "GetID() on 5 corpora of 50000 labels/pointers",   InitHashIds, FrameHashIds, ShutdownHashIds, false },
+    { "ids_literal",            "GetID() on 9 literal labels x 5000 seeds",         NULL, FrameIdsLiteral, NULL, false },
+    { "ids_hashed_literal",     "Same with IM_HASHED_LABEL() (hash computed at compile-time with C++14)", InitIdsHashedLiteral, FrameIdsHashedLiteral, NULL, false },
+    { "storage_insert",         "Build a ImGuiStorage with 10000 random keys",      InitStorage, FrameStorageInsert, ShutdownStorage, true },
+    { "storage_lookup",         "50000 ImGuiStorage::GetInt() on 50000 keys",       InitStorage, FrameStorageLookup, ShutdownStorage, true },
+    { "polyline_aa",            "AddPolyline() with 96000 points, anti-aliased",    InitPolyline, FramePolylineAA, ShutdownPolyline, true },
+    { "polyline_aa_thick",      "Same with thickness 3.0f",                         InitPolyline, FramePolylineAAThick, ShutdownPolyline, true },
+    { "polyline_no_aa",         "Same without anti-aliasing",                       InitPolyline, FramePolylineNoAA, ShutdownPolyline, true },
+    { "rects_single",           "100000 AddRectFilled()",                           InitBatch, FrameRectsSingle, ShutdownBatch, true },
+    { "rects_batch",            "Same with AddRectFilledBatch()",                   InitBatch, FrameRectsBatch, ShutdownBatch, true },
+    { "circles_single",         "100000 AddCircleFilled() with 8 segments",         InitBatch, FrameCirclesSingle, ShutdownBatch, true },
+    { "circles_batch",          "Same with AddCircleFilledBatch()",                 InitBatch, FrameCirclesBatch, ShutdownBatch, true },
+    { "circles_pins",           "20000 small AddCircleFilled() + AddCircle(), 100 large AddCircle()", InitBatch, FrameCirclesPins, ShutdownBatch, true },
+    { "pin_shapes",             "20000 pins made of AddCircleFilled() + AddCircle() + AddTriangleFilled()", InitBatch, FramePinShapesDirect, ShutdownBatch, true },
+    { "pin_shapes_stamp",       "Same recorded once in a ImDrawStamp, replayed with AddStamp()", InitBatch, FramePinShapesStamp, ShutdownBatch, true },
+    { "pin_shapes_stamp_batch", "Same with AddStampBatch()",                        InitBatch, FramePinShapesStampBatch, ShutdownBatch, true },
+    { "canvas",                 "20000 nodes of 5 primitives on a canvas, 90% outside of the clipping rectangle", InitPolyline, FrameCanvasNoCulling, ShutdownPolyline, true },
+    { "canvas_culled",          "Same with ImDrawListFlags_CoarseCulling",          InitPolyline, FrameCanvasCulling, ShutdownPolyline, true },
+    { "text_log_1m",            "ImGuiTextLog::Draw() with 1M lines",               InitTextLog, FrameTextLog, ShutdownTextLog, false },
+    { "text_log_1m_filter",     "Same with a filter matching 1000 lines (cached filtered index)", InitTextLog, FrameTextLogFilter, ShutdownTextLog, false },
+    { "text_log_1m_filter_scan", "Same filtering every line every frame, without clipping", InitTextLog, FrameTextLogFilterScan, ShutdownTextLog, false },
+    { "text_log_append",        "10000 ImGuiTextLog::Appendf() per frame with MaxSize = 4 MB", InitTextLogIngest, FrameTextLogAppend, ShutdownTextLog, false },
+    { "text_log_queue",         "Same with Pushf() (lock-free queue), drained by Draw()", InitTextLogIngest, FrameTextLogQueue, ShutdownTextLog, false },
+    { "text_buffer_appendf",    "200000 ImGuiTextBuffer::appendf() into an empty buffer", NULL, FrameTextBufferAppend, NULL, true },
+    { "text_buffer_appendf_chunked", "Same with ChunkSize = 1 MB",              NULL, FrameTextBufferAppendChunked, NULL, true },
+    { "text_buffer_1m",         "TextUnformattedBuffer() with 1M lines (40 MB), scrolled to the middle", InitTextBufferDisplay, FrameTextBufferDisplay, ShutdownTextBufferDisplay, false },
+    { "text_buffer_1m_chunked", "Same with ChunkSize = 1 MB",                      InitTextBufferDisplayChunked, FrameTextBufferDisplay, ShutdownTextBufferDisplay, false },
+    { "text_wrapped_4mb",       "TextUnformatted() with 4 MB of word-wrapped text, scrolled to the middle", InitTextWrapped, FrameTextWrapped, ShutdownTextBufferDisplay, false },
+    { "text_wrapped_4mb_resize", "Same at the top, with a different wrap width every frame", InitTextWrapped, FrameTextWrappedResize, ShutdownTextBufferDisplay, false },
+    { "text_wrapped_4mb_versioned", "Same scrolled to the middle, with SetNextItemTextVersion()", InitTextWrapped, FrameTextWrappedVersioned, ShutdownTextBufferDisplay, false },
+    { "file_viewer_256mb",      "ImGuiFileViewer::Draw() on a 256 MB file (6.1M lines), scrolled to the middle", InitFileViewer, FrameFileViewer, ShutdownFileViewer, false },
+    { "file_viewer_256mb_filter", "Same with a filter matching 6100 lines", InitFileViewerFilter, FrameFileViewer, ShutdownFileViewer, false },
+    { "plot_lines_1m",          "PlotLines() with 1M samples",                      InitPlotLines, FramePlotLines, ShutdownPlotLines, false },
+    { "font_atlas_cjk",         "Build atlas with GetGlyphRangesChineseFull()",     NULL, FrameFontAtlasCJK, NULL, true },
+    { "font_atlas_cjk_dynamic", "Same with ImFontAtlasFlags_DynamicGlyphs, 500 glyphs used", NULL, FrameFontAtlasCJKDynamic, NULL, true },
+    { "font_atlas_cjk_cached",  "Same with ImFontAtlas::CacheFilename, loaded from cache", InitFontAtlasCJKCached, FrameFontAtlasCJKCached, ShutdownFontAtlasCJKCached, true },
+    { "font_atlas_cjk_threaded", "Same with ImFontAtlas::ParallelForFn (see --threads)", NULL, FrameFontAtlasCJKThreaded, NULL, true },
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct BenchResult
+{
+    BenchSeries TimeNewFrame, TimeSubmit, TimeRender, TimeRaster, TimeTotal;
+    BenchSeries VtxCount, IdxCount, CmdCount, CmdListCount, UploadBytes, DamagedAreaRatio;
+    BenchSeries Allocs, AllocBytes;
+};
+
+static void RunScenario(const BenchScenario& scenario, const BenchOptions& opts, BenchResult* result)
+{
+    g_ExtraValues.clear();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+
+    // Build atlas
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    // Software rasterizer, rendering to a buffer of the display size (not measured in 'total')
+    ImVector<ImU32> raster_pixels;
+    const bool raster = opts.Raster && !scenario.NoFrame;
+    if (raster)
+    {
+        ImGui_ImplSoftRaster_Init(BenchParallelFor, (void*)&opts.Threads);
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+        raster_pixels.resize((int)io.DisplaySize.x * (int)io.DisplaySize.y);
+    }
+
+    if (scenario.Init)
+        scenario.Init(opts);
+
+    const int total_frames = opts.WarmupFrames + opts.Frames;
+    for (int n = 0; n < total_frames; n++)
+    {
+        const bool measure = (n >= opts.WarmupFrames);
+        const BenchAllocStats alloc_backup = g_AllocStats;
+        BenchClock::time_point t0 = BenchClock::now();
+        if (scenario.NoFrame)
+        {
+            scenario.Frame(opts);
+            BenchClock::time_point t1 = BenchClock::now();
+            if (measure)
+            {
+                result->TimeSubmit.Add(BenchElapsedMs(t0, t1));
+                result->TimeTotal.Add(BenchElapsedMs(t0, t1));
+                result->Allocs.Add(g_AllocStats.AllocCount - alloc_backup.AllocCount);
+                result->AllocBytes.Add((double)(g_AllocStats.AllocBytes - alloc_backup.AllocBytes));
+            }
+            continue;
+        }
+
+        ImGui::NewFrame();
+        BenchClock::time_point t1 = BenchClock::now();
+        scenario.Frame(opts);
+        BenchClock::time_point t2 = BenchClock::now();
+        ImGui::Render();
+        BenchClock::time_point t3 = BenchClock::now();
+        if (raster)
+        {
+            memset(raster_pixels.Data, 0, (size_t)raster_pixels.size_in_bytes());
+            BenchClock::time_point t4 = BenchClock::now();
+            ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), raster_pixels.Data, (int)io.DisplaySize.x, (int)io.DisplaySize.y, (int)io.DisplaySize.x * (int)sizeof(ImU32));
+            if (measure)
+                result->TimeRaster.Add(BenchElapsedMs(t4, BenchClock::now()));
+        }
+        if (!measure)
+            continue;
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        int cmd_count = 0;
+        for (int cmd_list_n = 0; cmd_list_n < draw_data->CmdListsCount; cmd_list_n++)
+            cmd_count += draw_data->CmdLists[cmd_list_n]->CmdBuffer.Size;
+        result->TimeNewFrame.Add(BenchElapsedMs(t0, t1));
+        result->TimeSubmit.Add(BenchElapsedMs(t1, t2));
+        result->TimeRender.Add(BenchElapsedMs(t2, t3));
+        result->TimeTotal.Add(BenchElapsedMs(t0, t3));
+        result->VtxCount.Add(draw_data->TotalVtxCount);
+        result->IdxCount.Add(draw_data->TotalIdxCount);
+        result->CmdCount.Add(cmd_count);
+        result->CmdListCount.Add(draw_data->CmdListsCount);
+        result->UploadBytes.Add((double)draw_data->TotalVtxCount * sizeof(ImDrawVert) + (double)draw_data->TotalIdxCount * sizeof(ImDrawIdx));
+        if (io.ConfigDrawDataDamageRects)
+        {
+            double damaged_area = 0.0;
+            for (int rect_n = 0; rect_n < draw_data->DamageRectsCount; rect_n++)
+                damaged_area += (double)(draw_data->DamageRects[rect_n].z - draw_data->DamageRects[rect_n].x) * (draw_data->DamageRects[rect_n].w - draw_data->DamageRects[rect_n].y);
+            result->DamagedAreaRatio.Add(damaged_area / ((double)io.DisplaySize.x * io.DisplaySize.y));
+        }
+        result->Allocs.Add(g_AllocStats.AllocCount - alloc_backup.AllocCount);
+        result->AllocBytes.Add((double)(g_AllocStats.AllocBytes - alloc_backup.AllocBytes));
+    }
+
+    if (scenario.Shutdown)
+        scenario.Shutdown();
+    if (raster)
+        ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext();
+}
+
+static void PrintSeries(FILE* f, const char* name, const BenchSeries& s, bool last = false)
+{
+    fprintf(f, "        \"%s\": { \"avg\": %.4f, \"min\": %.4f, \"max\": %.4f }%s\n", name, s.Avg(), s.Min, s.Max, last ? "" : ",");
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions opts;
+    opts.Frames = 100;
+    opts.WarmupFrames = 5;
+    opts.ScenarioFilter = NULL;
+    opts.CjkFontFilename = NULL;
+    opts.OutputFilename = NULL;
+    opts.Raster = false;
+    opts.Threads = (int)std::thread::hardware_concurrency();
+
+    const int scenarios_count = (int)(sizeof(g_Scenarios) / sizeof(g_Scenarios[0]));
+    for (int n = 1; n < argc; n++)
+    {
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(argv[n], "--frames") == 0 && has_value)
+            opts.Frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--warmup") == 0 && has_value)
+            opts.WarmupFrames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--scenario") == 0 && has_value)
+            opts.ScenarioFilter = argv[++n];
+        else if (strcmp(argv[n], "--cjk-font") == 0 && has_value)
+            opts.CjkFontFilename = argv[++n];
+        else if (strcmp(argv[n], "--threads") == 0 && has_value)
+            opts.Threads = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--raster") == 0)
+            opts.Raster = true;
+        else if (strcmp(argv[n], "--out") == 0 && has_value)
+            opts.OutputFilename = argv[++n];
+        else if (strcmp(argv[n], "--list") == 0)
+        {
+            for (int scenario_n = 0; scenario_n < scenarios_count; scenario_n++)
+                printf("%-24s %s\n", g_Scenarios[scenario_n].Name, g_Scenarios[scenario_n].Desc);
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--scenario NAME] [--cjk-font FILE.ttf] [--threads N] [--raster] [--out FILE.json] [--list]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (opts.Frames < 1)
+        opts.Frames = 1;
+    if (opts.Threads < 1)
+        opts.Threads = 1;
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(BenchMallocWrapper, BenchFreeWrapper, NULL);
+
+    FILE* f = opts.OutputFilename ? fopen(opts.OutputFilename, "wt") : stdout;
+    if (f == NULL)
+    {
+        fprintf(stderr, "Failed to open '%s'\n", opts.OutputFilename);
+        return 1;
+    }
+
+    fprintf(f, "{\n  \"imgui_version\": \"%s\",\n  \"frames\": %d,\n  \"warmup_frames\": %d,\n  \"threads\": %d,\n", ImGui::GetVersion(), opts.Frames, opts.WarmupFrames, opts.Threads);
+    fprintf(f, "  \"sizeof_drawvert\": %d,\n  \"sizeof_drawidx\": %d,\n", (int)sizeof(ImDrawVert), (int)sizeof(ImDrawIdx));
+#ifdef IMGUI_USE_FAST_HASH
+    fprintf(f, "  \"id_hash\": \"fast\",\n");
+#else
+    fprintf(f, "  \"id_hash\": \"crc32\",\n");
+#endif
+#ifdef IMGUI_USE_HASHED_STORAGE
+    fprintf(f, "  \"storage\": \"hashed\",\n");
+#else
+    fprintf(f, "  \"storage\": \"sorted\",\n");
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    fprintf(f, "  \"drawvert\": \"compact\",\n");
+#else
+    fprintf(f, "  \"drawvert\": \"default\",\n");
+#endif
+    fprintf(f, "  \"scenarios\": [\n");
+    bool first = true;
+    for (int scenario_n = 0; scenario_n < scenarios_count; scenario_n++)
+    {
+        const BenchScenario& scenario = g_Scenarios[scenario_n];
+        if (opts.ScenarioFilter && strstr(scenario.Name, opts.ScenarioFilter) == NULL)
+            continue;
+        if (opts.CjkFontFilename == NULL && strncmp(scenario.Name, "font_atlas_cjk", 14) == 0)
+        {
+            fprintf(stderr, "Skipping '%s': no CJK font, use --cjk-font FILE.ttf\n", scenario.Name);
+            continue;
+        }
+
+        BenchResult result;
+        RunScenario(scenario, opts, &result);
+
+        fprintf(f, "%s    {\n      \"name\": \"%s\",\n      \"desc\": \"%s\",\n", first ? "" : ",\n", scenario.Name, scenario.Desc);
+        fprintf(f, "      \"time_ms\": {\n");
+        PrintSeries(f, "new_frame", result.TimeNewFrame);
+        PrintSeries(f, "submit", result.TimeSubmit);
+        PrintSeries(f, "render", result.TimeRender);
+        if (opts.Raster && !scenario.NoFrame)
+            PrintSeries(f, "raster", result.TimeRaster);
+        PrintSeries(f, "total", result.TimeTotal, true);
+        fprintf(f, "      },\n      \"counts\": {\n");
+        PrintSeries(f, "vertices", result.VtxCount);
+        PrintSeries(f, "indices", result.IdxCount);
+        PrintSeries(f, "draw_cmds", result.CmdCount);
+        PrintSeries(f, "draw_lists", result.CmdListCount);
+        PrintSeries(f, "upload_bytes", result.UploadBytes);
+        if (result.DamagedAreaRatio.Count > 0)
+            PrintSeries(f, "damaged_area_ratio", result.DamagedAreaRatio);
+        PrintSeries(f, "allocs", result.Allocs);
+        PrintSeries(f, "alloc_bytes", result.AllocBytes, true);
+        fprintf(f, "      }");
+        if (!g_ExtraValues.empty())
+        {
+            fprintf(f, ",\n      \"extra\": {\n");
+            for (int n = 0; n < g_ExtraValues.Size; n++)
+                fprintf(f, "        \"%s\": %.4f%s\n", g_ExtraValues[n].Name, g_ExtraValues[n].Value, (n + 1 < g_ExtraValues.Size) ? "," : "");
+            fprintf(f, "      }");
+        }
+        fprintf(f, "\n    }");
+        first = false;
+    }
+    fprintf(f, "\n  ]\n}\n");
+
+    if (f != stdout)
+        fclose(f);
+    return 0;
+}
@@ -26,6 +26,10 @@
 #include "imgui.h"
 #include "imgui_impl_dx10.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "This back-end doesn't support IMGUI_USE_COMPACT_DRAWVERT."
+#endif
+
 // DirectX
 #include <stdio.h>
 #include <d3d10_1.h>
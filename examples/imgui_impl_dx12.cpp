@@ -26,6 +26,10 @@
 #include "imgui.h"
 #include "imgui_impl_dx12.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "This back-end doesn't support IMGUI_USE_COMPACT_DRAWVERT."
+#endif
+
 // DirectX
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -25,6 +25,10 @@
 #include "imgui.h"
 #include "imgui_impl_dx9.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "This back-end doesn't support IMGUI_USE_COMPACT_DRAWVERT."
+#endif
+
 // DirectX
 #include <d3d9.h>
 #define DIRECTINPUT_VERSION 0x0800
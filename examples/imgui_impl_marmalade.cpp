@@ -21,6 +21,10 @@
 #include "imgui.h"
 #include "imgui_impl_marmalade.h"
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "This back-end doesn't support IMGUI_USE_COMPACT_DRAWVERT."
+#endif
+
 #include <s3eClipboard.h>
 #include <s3ePointer.h>
 #include <s3eKeyboard.h>
@@ -18,6 +18,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2019-07-02: OpenGL: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT), texture coordinates are converted to floats.
+//  2019-06-12: OpenGL: Uploading font glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs) using io.Fonts->TexDirtyRects.
 //  2019-04-30: OpenGL: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-02-11: OpenGL: Projecting clipping rectangles correctly using draw_data->FramebufferScale to allow multi-viewports for retina display.
 //  2018-11-30: Misc: Setting up io.BackendRendererName so it can be displayed in the About Window.
@@ -53,6 +55,9 @@
 
 // OpenGL Data
 static GLuint       g_FontTexture = 0;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+static ImVector<ImVec2> g_TexCoordsBuffer;      // Texture coordinates converted to floats
+#endif
 
 // Functions
 bool    ImGui_ImplOpenGL2_Init()
@@ -108,6 +113,30 @@ static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
     glLoadIdentity();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Compact vertex layout: positions are in fixed-point
+    glScalef(1.0f / IM_DRAWVERT_POS_SCALE, 1.0f / IM_DRAWVERT_POS_SCALE, 1.0f);
+#endif
+}
+
+// Upload glyphs rasterized since last frame (ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplOpenGL2_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.empty() || !g_FontTexture || atlas->TexPixelsRGBA32 == NULL)
+        return;
+
+    GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth);
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+        glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + r.Y * atlas->TexWidth + r.X);
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+    atlas->TexDirtyRects.clear();
 }
 
 // OpenGL2 Render function.
@@ -121,6 +150,8 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     if (fb_width == 0 || fb_height == 0)
         return;
 
+    ImGui_ImplOpenGL2_UpdateFontsTexture();
+
     // Backup GL state
     GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
     GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
@@ -141,8 +172,17 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
         const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Compact vertex layout: glTexCoordPointer() doesn't support normalized 16-bit texture coordinates, convert them to floats
+        g_TexCoordsBuffer.resize(cmd_list->VtxBuffer.Size);
+        for (int vtx_i = 0; vtx_i < cmd_list->VtxBuffer.Size; vtx_i++)
+            g_TexCoordsBuffer.Data[vtx_i] = vtx_buffer[vtx_i].uv;
+        glVertexPointer(2, GL_SHORT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
+        glTexCoordPointer(2, GL_FLOAT, sizeof(ImVec2), (const GLvoid*)g_TexCoordsBuffer.Data);
+#else
         glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
         glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, uv)));
+#endif
         glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)));
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
@@ -212,6 +252,7 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    io.Fonts->TexDirtyRects.clear();
 
     // Store our identifier
     io.Fonts->TexID = (ImTextureID)(intptr_t)g_FontTexture;
@@ -241,4 +282,7 @@ bool    ImGui_ImplOpenGL2_CreateDeviceObjects()
 void    ImGui_ImplOpenGL2_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL2_DestroyFontsTexture();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    g_TexCoordsBuffer.clear();
+#endif
 }
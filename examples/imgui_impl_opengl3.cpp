@@ -13,6 +13,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2019-07-02: OpenGL: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT).
+//  2019-07-01: OpenGL: Uploading vertex/index buffers of all command lists at once using ImDrawData::MergeBuffers() (except on ES 2.0).
+//  2019-06-12: OpenGL: Uploading font glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs) using io.Fonts->TexDirtyRects.
 //  2019-05-29: OpenGL: Desktop GL only: Added support for large mesh (64K+ vertices), enable ImGuiBackendFlags_RendererHasVtxOffset flag.
 //  2019-04-30: OpenGL: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-03-29: OpenGL: Not calling glBindBuffer more than necessary in the render loop.
@@ -115,6 +118,13 @@
 #define IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX     1
 #endif
 
+// Desktop GL and GL ES 3.0 upload the vertex/index buffers of all command lists at once. GL ES 2.0 doesn't support 32-bit indices (without an extension).
+#if IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX || !defined(IMGUI_IMPL_OPENGL_ES2)
+#define IMGUI_IMPL_OPENGL_MERGE_BUFFERS                 1
+#else
+#define IMGUI_IMPL_OPENGL_MERGE_BUFFERS                 0
+#endif
+
 // OpenGL Data
 static char         g_GlslVersionString[32] = "";
 static GLuint       g_FontTexture = 0;
@@ -122,6 +132,14 @@ static GLuint       g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
 static int          g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;                                // Uniforms location
 static int          g_AttribLocationVtxPos = 0, g_AttribLocationVtxUV = 0, g_AttribLocationVtxColor = 0; // Vertex attributes location
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
+#if IMGUI_IMPL_OPENGL_MERGE_BUFFERS
+static ImVector<ImDrawVert>     g_MergedVtxBuffer;                                                // Vertices of all command lists, uploaded at once
+#if IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+static ImVector<ImDrawIdx>      g_MergedIdxBuffer;                                                // Indices of all command lists, drawn with each command's VtxOffset as base vertex
+#else
+static ImVector<unsigned int>   g_MergedIdxBuffer;                                                // Indices of all command lists, rebased to the start of g_MergedVtxBuffer
+#endif
+#endif
 
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
@@ -188,13 +206,18 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
     float T = draw_data->DisplayPos.y;
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
-    const float ortho_projection[4][4] =
+    float ortho_projection[4][4] =
     {
         { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
         { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Compact vertex layout: positions are in fixed-point
+    ortho_projection[0][0] /= IM_DRAWVERT_POS_SCALE;
+    ortho_projection[1][1] /= IM_DRAWVERT_POS_SCALE;
+#endif
     glUseProgram(g_ShaderHandle);
     glUniform1i(g_AttribLocationTex, 0);
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -213,11 +236,45 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glEnableVertexAttribArray(g_AttribLocationVtxPos);
     glEnableVertexAttribArray(g_AttribLocationVtxUV);
     glEnableVertexAttribArray(g_AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+// Upload glyphs rasterized since last frame (ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.empty() || !g_FontTexture || atlas->TexPixelsRGBA32 == NULL)
+        return;
+
+    GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+#ifdef GL_UNPACK_ROW_LENGTH
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth);
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+        glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + r.Y * atlas->TexWidth + r.X);
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#else
+    // No GL_UNPACK_ROW_LENGTH on ES 2.0: upload full rows
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, r.Y, atlas->TexWidth, r.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + r.Y * atlas->TexWidth);
+    }
+#endif
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+    atlas->TexDirtyRects.clear();
+}
+
 // OpenGL3 Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly, in order to be able to run within any OpenGL engine that doesn't do so.
@@ -229,6 +286,8 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     if (fb_width <= 0 || fb_height <= 0)
         return;
 
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
+
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
     glActiveTexture(GL_TEXTURE0);
@@ -276,14 +335,37 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+    // Upload vertex/index buffers of all command lists at once
+    // Desktop GL: indices are kept as-is and drawn with glDrawElementsBaseVertex(). GL ES 3.0: indices are converted to 32-bit and rebased.
+#if IMGUI_IMPL_OPENGL_MERGE_BUFFERS
+    const GLenum idx_type = (sizeof(g_MergedIdxBuffer.Data[0]) == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    g_MergedVtxBuffer.resize(draw_data->TotalVtxCount);
+    g_MergedIdxBuffer.resize(draw_data->TotalIdxCount);
+#if IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+    draw_data->MergeBuffers(g_MergedVtxBuffer.Data, g_MergedIdxBuffer.Data);
+#else
+    draw_data->MergeBuffersIdx32(g_MergedVtxBuffer.Data, g_MergedIdxBuffer.Data);
+#endif
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)g_MergedVtxBuffer.size_in_bytes(), (const GLvoid*)g_MergedVtxBuffer.Data, GL_STREAM_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)g_MergedIdxBuffer.size_in_bytes(), (const GLvoid*)g_MergedIdxBuffer.Data, GL_STREAM_DRAW);
+#else
+    const GLenum idx_type = (sizeof(ImDrawIdx) == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+#endif
+
     // Render command lists
+#if IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+    int global_vtx_offset = 0;
+#endif
+    int global_idx_offset = 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
 
+#if !IMGUI_IMPL_OPENGL_MERGE_BUFFERS
         // Upload vertex/index buffers
         glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+#endif
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -317,13 +399,19 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     // Bind texture, Draw
                     glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
 #if IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
-                    glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
+                    glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * sizeof(ImDrawIdx)), (GLint)(pcmd->VtxOffset + global_vtx_offset));
 #else
-                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)));
+                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * (idx_type == GL_UNSIGNED_SHORT ? 2 : 4)));
 #endif
                 }
             }
         }
+#if IMGUI_IMPL_OPENGL_MERGE_BUFFERS
+        global_idx_offset += cmd_list->IdxBuffer.Size;
+#endif
+#if IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+#endif
     }
 
     // Destroy the temporary VAO
@@ -374,6 +462,7 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    io.Fonts->TexDirtyRects.clear();
 
     // Store our identifier
     io.Fonts->TexID = (ImTextureID)(intptr_t)g_FontTexture;
@@ -616,6 +705,10 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (g_VboHandle) glDeleteBuffers(1, &g_VboHandle);
     if (g_ElementsHandle) glDeleteBuffers(1, &g_ElementsHandle);
     g_VboHandle = g_ElementsHandle = 0;
+#if IMGUI_IMPL_OPENGL_MERGE_BUFFERS
+    g_MergedVtxBuffer.clear();
+    g_MergedIdxBuffer.clear();
+#endif
 
     if (g_ShaderHandle && g_VertHandle) glDetachShader(g_ShaderHandle, g_VertHandle);
     if (g_VertHandle) glDeleteShader(g_VertHandle);
@@ -0,0 +1,544 @@
+// dear imgui: Renderer for a CPU software rasterizer, drawing into a 32-bit RGBA buffer in memory
+// This can be used along with a Platform Binding (e.g. GLFW, SDL, Win32, custom..) presenting the buffer, or headless
+// (e.g. to compare screenshots in tests, or to measure fill cost without depending on a GPU driver).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Multi-threaded rendering: the target is split in tiles which can be rendered in parallel by a user-provided function.
+// Missing features:
+//  [ ] Renderer: Texture sampling uses nearest filtering (text and icons are pixel aligned so this rarely matters).
+
+// You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
+// If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
+// https://github.com/ocornut/imgui
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2019-07-16: Renderer: User callbacks run in submission order, after the triangles submitted before them are rendered.
+//  2019-07-03: Initial version.
+
+// How it works:
+// - RenderDrawData() sets up every visible triangle once: vertices are snapped to 1/16 pixel, edge functions are computed
+//   in integers (so triangles sharing an edge never cover the same pixel twice, which matters for translucent shapes),
+//   colors and texture coordinates are interpolated with plane equations.
+// - Triangles are binned into tiles of TILE_SIZE x TILE_SIZE pixels, in submission order.
+// - Tiles are rendered independently (with the parallel-for function if provided): each triangle is rasterized one span
+//   per row, its texture is sampled and its color blended like glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) would.
+// - A user callback splits the draw data in batches: triangles set up before it are binned and rendered, then it is called,
+//   so it sees the pixels of everything submitted before it (and none submitted after it), like with a GPU back-end.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <math.h>       // floorf
+#include <string.h>     // memset
+#if (defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(IMGUI_DISABLE_SIMD)
+#define IMGUI_IMPL_SOFTRASTER_ENABLE_SSE
+#include <emmintrin.h>
+#endif
+
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS     4           // Vertices are snapped to 1/16 pixel
+#define IMGUI_IMPL_SOFTRASTER_TILE_SHIFT        6           // Tiles of 64x64 pixels
+#define IMGUI_IMPL_SOFTRASTER_GUARD_BAND        1048576.0f  // Positions are clamped to +/- this many pixels before snapping
+
+enum ImGui_ImplSoftRaster_TriangleFlags_
+{
+    ImGui_ImplSoftRaster_TriangleFlags_ConstCol = 1 << 0,   // All vertices have the same color
+    ImGui_ImplSoftRaster_TriangleFlags_ConstUV  = 1 << 1    // All vertices have the same texture coordinates (e.g. the white pixel), sampled once in Texel
+};
+
+// Setup data for a triangle, values are evaluated at the center of pixel (0,0) and stepped by ddx/ddy for other pixels
+struct ImGui_ImplSoftRaster_Triangle
+{
+    int             MinX, MinY, MaxX, MaxY;     // Bounding box in pixels, intersected with the clipping rectangle (Max is exclusive)
+    ImS64           Edge[3], EdgeDx[3], EdgeDy[3]; // Edge functions (>= 0 inside), in 1/256 pixel units
+    float           Attr[6], AttrDx[6], AttrDy[6]; // U, V (in texels), R, G, B, A (0..255)
+    const ImGui_ImplSoftRaster_Texture* Texture;
+    ImU32           Col;                        // Color when ConstCol is set (multiplied by Texel when ConstUV is also set)
+    ImU32           Texel;                      // Texel when ConstUV is set
+    int             Flags;
+};
+
+// Renderer Data
+static ImGui_ImplSoftRaster_Texture             g_FontTexture = { NULL, 0, 0, 0 };
+static ImGui_ImplSoftRaster_ParallelForFn       g_ParallelForFn = NULL;
+static void*                                    g_ParallelForUserData = NULL;
+static ImVector<ImGui_ImplSoftRaster_Triangle>  g_Triangles;
+static ImVector<int>                            g_TileOffsets;      // Index of the first triangle of each tile in g_TileTriangles[], + total count at the end
+static ImVector<int>                            g_TileCursors;
+static ImVector<int>                            g_TileTriangles;    // Triangle indices of all tiles, in submission order
+static ImVector<int>                            g_ActiveTiles;      // Tiles with at least one triangle
+static int                                      g_TilesCountX = 0;
+static ImU32*                                   g_TargetPixels = NULL;
+static int                                      g_TargetPitch = 0;
+
+// Functions
+bool    ImGui_ImplSoftRaster_Init(ImGui_ImplSoftRaster_ParallelForFn parallel_for_fn, void* parallel_for_user_data)
+{
+    // Setup back-end capabilities flags
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    g_ParallelForFn = parallel_for_fn;
+    g_ParallelForUserData = parallel_for_user_data;
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+    g_Triangles.clear();
+    g_TileOffsets.clear();
+    g_TileCursors.clear();
+    g_TileTriangles.clear();
+    g_ActiveTiles.clear();
+    g_ParallelForFn = NULL;
+    g_ParallelForUserData = NULL;
+}
+
+void    ImGui_ImplSoftRaster_NewFrame()
+{
+    if (!g_FontTexture.Pixels)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+template<typename T> static inline T ImGui_ImplSoftRaster_Min(T lhs, T rhs) { return lhs < rhs ? lhs : rhs; }
+template<typename T> static inline T ImGui_ImplSoftRaster_Max(T lhs, T rhs) { return lhs >= rhs ? lhs : rhs; }
+
+// 'a * b / 255' rounded to nearest, for a and b in 0..255
+static inline ImU32 ImGui_ImplSoftRaster_Mul8(ImU32 a, ImU32 b)
+{
+    const ImU32 t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_FloatToByte(float f)
+{
+    const int i = (int)(f + 0.5f);
+    return (ImU32)(i < 0 ? 0 : i > 255 ? 255 : i);
+}
+
+// Color multiplied by texel, component-wise
+static inline ImU32 ImGui_ImplSoftRaster_Modulate(ImU32 col, ImU32 texel)
+{
+    return (ImGui_ImplSoftRaster_Mul8((col >> 0) & 0xFF, (texel >> 0) & 0xFF) << 0) |
+           (ImGui_ImplSoftRaster_Mul8((col >> 8) & 0xFF, (texel >> 8) & 0xFF) << 8) |
+           (ImGui_ImplSoftRaster_Mul8((col >> 16) & 0xFF, (texel >> 16) & 0xFF) << 16) |
+           (ImGui_ImplSoftRaster_Mul8((col >> 24) & 0xFF, (texel >> 24) & 0xFF) << 24);
+}
+
+// Color with its alpha multiplied by 'alpha' (texel of a 1 byte per pixel texture)
+static inline ImU32 ImGui_ImplSoftRaster_ModulateAlpha(ImU32 col, ImU32 alpha)
+{
+    return (col & ~IM_COL32_A_MASK) | (ImGui_ImplSoftRaster_Mul8((col >> IM_COL32_A_SHIFT) & 0xFF, alpha) << IM_COL32_A_SHIFT);
+}
+
+// dst = src * src_alpha + dst * (1 - src_alpha) on all 4 components (including alpha, like the GL/DX back-ends), two components at a time
+static inline ImU32 ImGui_ImplSoftRaster_Blend(ImU32 dst, ImU32 src)
+{
+    const ImU32 a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0xFF)
+        return src;
+    const ImU32 inv_a = 0xFF - a;
+    ImU32 c02 = (src & 0x00FF00FF) * a + (dst & 0x00FF00FF) * inv_a + 0x00800080;
+    ImU32 c13 = ((src >> 8) & 0x00FF00FF) * a + ((dst >> 8) & 0x00FF00FF) * inv_a + 0x00800080;
+    c02 = ((c02 + ((c02 >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    c13 = (c13 + ((c13 >> 8) & 0x00FF00FF)) & 0xFF00FF00;
+    return c02 | c13;
+}
+
+// Blend the same color over a span of pixels (4 pixels at a time with SSE2, same results as ImGui_ImplSoftRaster_Blend())
+static void ImGui_ImplSoftRaster_BlendSpan(ImU32* dst, ImU32* dst_end, ImU32 src)
+{
+#ifdef IMGUI_IMPL_SOFTRASTER_ENABLE_SSE
+    const ImU32 a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)src), zero);
+    const __m128i src_mul = _mm_add_epi16(_mm_mullo_epi16(src16, _mm_set1_epi16((short)a)), _mm_set1_epi16(0x80));
+    const __m128i inv_a = _mm_set1_epi16((short)(0xFF - a));
+    for (; dst + 4 <= dst_end; dst += 4)
+    {
+        const __m128i d = _mm_loadu_si128((const __m128i*)dst);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_a), src_mul);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_a), src_mul);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; dst < dst_end; dst++)
+        *dst = ImGui_ImplSoftRaster_Blend(*dst, src);
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_SampleTexture(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    int x = (int)u, y = (int)v;
+    x = (x < 0) ? 0 : (x >= tex->Width) ? tex->Width - 1 : x;
+    y = (y < 0) ? 0 : (y >= tex->Height) ? tex->Height - 1 : y;
+    if (tex->BytesPerPixel == 1)
+        return ((ImU32)((const unsigned char*)tex->Pixels)[y * tex->Width + x] << IM_COL32_A_SHIFT) | (IM_COL32_WHITE & ~IM_COL32_A_MASK);
+    return ((const ImU32*)tex->Pixels)[y * tex->Width + x];
+}
+
+static void ImGui_ImplSoftRaster_SetupTriangle(const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImGui_ImplSoftRaster_Texture* tex, const int clip[4], const ImVec2& clip_off, const ImVec2& clip_scale)
+{
+    // Project and snap positions
+    const int sub = 1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS;
+    const float guard = IMGUI_IMPL_SOFTRASTER_GUARD_BAND;
+    ImS64 px[3], py[3];
+    const ImDrawVert* vtx[3] = { v0, v1, v2 };
+    for (int n = 0; n < 3; n++)
+    {
+        const ImVec2 pos = vtx[n]->pos;
+        float x = (pos.x - clip_off.x) * clip_scale.x;
+        float y = (pos.y - clip_off.y) * clip_scale.y;
+        x = (x < -guard) ? -guard : (x > guard) ? guard : x;
+        y = (y < -guard) ? -guard : (y > guard) ? guard : y;
+        px[n] = (ImS64)floorf(x * sub + 0.5f);
+        py[n] = (ImS64)floorf(y * sub + 0.5f);
+    }
+
+    // Orient the triangle so edge functions are positive inside, skip degenerate ones
+    ImS64 area = (px[1] - px[0]) * (py[2] - py[0]) - (py[1] - py[0]) * (px[2] - px[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        ImS64 tx = px[1]; px[1] = px[2]; px[2] = tx;
+        ImS64 ty = py[1]; py[1] = py[2]; py[2] = ty;
+        const ImDrawVert* tv = vtx[1]; vtx[1] = vtx[2]; vtx[2] = tv;
+        area = -area;
+    }
+
+    // Bounding box of pixel centers, clipped
+    ImS64 min_x = ImGui_ImplSoftRaster_Min(px[0], ImGui_ImplSoftRaster_Min(px[1], px[2])), max_x = ImGui_ImplSoftRaster_Max(px[0], ImGui_ImplSoftRaster_Max(px[1], px[2]));
+    ImS64 min_y = ImGui_ImplSoftRaster_Min(py[0], ImGui_ImplSoftRaster_Min(py[1], py[2])), max_y = ImGui_ImplSoftRaster_Max(py[0], ImGui_ImplSoftRaster_Max(py[1], py[2]));
+    const int bb_min_x = (int)ImGui_ImplSoftRaster_Max((ImS64)clip[0], min_x >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS);
+    const int bb_min_y = (int)ImGui_ImplSoftRaster_Max((ImS64)clip[1], min_y >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS);
+    const int bb_max_x = (int)ImGui_ImplSoftRaster_Min((ImS64)clip[2], (max_x >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS) + 1);
+    const int bb_max_y = (int)ImGui_ImplSoftRaster_Min((ImS64)clip[3], (max_y >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS) + 1);
+    if (bb_min_x >= bb_max_x || bb_min_y >= bb_max_y)
+        return;
+
+    g_Triangles.resize(g_Triangles.Size + 1);
+    ImGui_ImplSoftRaster_Triangle& tri = g_Triangles.back();
+    tri.MinX = bb_min_x;
+    tri.MinY = bb_min_y;
+    tri.MaxX = bb_max_x;
+    tri.MaxY = bb_max_y;
+
+    // Edge functions for edges (v1,v2), (v2,v0), (v0,v1) evaluated at the center of pixel (0,0).
+    // Fill convention: pixels centers exactly on an edge belong to the triangle only for top and left edges.
+    const ImS64 half = sub / 2;
+    for (int n = 0; n < 3; n++)
+    {
+        const int a = (n + 1) % 3, b = (n + 2) % 3;
+        const ImS64 dx = px[b] - px[a], dy = py[b] - py[a];
+        const bool top_left = (dy < 0) || (dy == 0 && dx > 0);
+        tri.Edge[n] = dx * (half - py[a]) - dy * (half - px[a]) - (top_left ? 0 : 1);
+        tri.EdgeDx[n] = -dy * sub;
+        tri.EdgeDy[n] = dx * sub;
+    }
+
+    // Plane equations for attributes, using snapped positions
+    const float x0 = (float)px[0] / sub, y0 = (float)py[0] / sub;
+    const float x1 = (float)px[1] / sub - x0, y1 = (float)py[1] / sub - y0;
+    const float x2 = (float)px[2] / sub - x0, y2 = (float)py[2] / sub - y0;
+    const float inv_area = 1.0f / (x1 * y2 - y1 * x2);
+    float attr[3][6];
+    for (int n = 0; n < 3; n++)
+    {
+        const ImVec2 uv = vtx[n]->uv;
+        const ImU32 col = vtx[n]->col;
+        attr[n][0] = uv.x * tex->Width;
+        attr[n][1] = uv.y * tex->Height;
+        attr[n][2] = (float)((col >> IM_COL32_R_SHIFT) & 0xFF);
+        attr[n][3] = (float)((col >> IM_COL32_G_SHIFT) & 0xFF);
+        attr[n][4] = (float)((col >> IM_COL32_B_SHIFT) & 0xFF);
+        attr[n][5] = (float)((col >> IM_COL32_A_SHIFT) & 0xFF);
+    }
+    for (int k = 0; k < 6; k++)
+    {
+        const float a1 = attr[1][k] - attr[0][k], a2 = attr[2][k] - attr[0][k];
+        tri.AttrDx[k] = (a1 * y2 - a2 * y1) * inv_area;
+        tri.AttrDy[k] = (a2 * x1 - a1 * x2) * inv_area;
+        tri.Attr[k] = attr[0][k] + tri.AttrDx[k] * (0.5f - x0) + tri.AttrDy[k] * (0.5f - y0);
+    }
+
+    // Constant color and/or texel
+    tri.Texture = tex;
+    tri.Col = vtx[0]->col;
+    tri.Texel = 0;
+    tri.Flags = 0;
+    if (vtx[0]->col == vtx[1]->col && vtx[0]->col == vtx[2]->col)
+        tri.Flags |= ImGui_ImplSoftRaster_TriangleFlags_ConstCol;
+    const ImVec2 uv0 = vtx[0]->uv, uv1 = vtx[1]->uv, uv2 = vtx[2]->uv;
+    if (uv0.x == uv1.x && uv0.y == uv1.y && uv0.x == uv2.x && uv0.y == uv2.y)
+    {
+        tri.Flags |= ImGui_ImplSoftRaster_TriangleFlags_ConstUV;
+        tri.Texel = ImGui_ImplSoftRaster_SampleTexture(tex, attr[0][0], attr[0][1]);
+        if (tri.Flags & ImGui_ImplSoftRaster_TriangleFlags_ConstCol)
+            tri.Col = ImGui_ImplSoftRaster_Modulate(tri.Col, tri.Texel);
+    }
+    if ((tri.Flags & ImGui_ImplSoftRaster_TriangleFlags_ConstCol) && (tri.Col & IM_COL32_A_MASK) == 0)
+        g_Triangles.pop_back();
+}
+
+// Rasterize a triangle within [x0,x1)x[y0,y1). BPP: bytes per pixel of the texture, or 0 when the texel is constant.
+template<bool CONST_COL, int BPP>
+static void ImGui_ImplSoftRaster_RasterizeTriangle(const ImGui_ImplSoftRaster_Triangle& tri, int x0, int y0, int x1, int y1)
+{
+    const ImGui_ImplSoftRaster_Texture* tex = tri.Texture;
+    for (int y = y0; y < y1; y++)
+    {
+        // Find the span of pixels inside all edges: e + dx * (x - x0) >= 0
+        int span_x0 = x0, span_x1 = x1;
+        for (int n = 0; n < 3 && span_x0 < span_x1; n++)
+        {
+            const ImS64 e = tri.Edge[n] + tri.EdgeDx[n] * x0 + tri.EdgeDy[n] * y;
+            const ImS64 dx = tri.EdgeDx[n];
+            if (dx > 0)
+            {
+                if (e < 0)
+                {
+                    const ImS64 first = x0 + (-e + dx - 1) / dx;
+                    if (first > span_x0)
+                        span_x0 = (first < span_x1) ? (int)first : span_x1;
+                }
+            }
+            else if (e < 0)
+            {
+                span_x1 = span_x0;
+            }
+            else if (dx < 0)
+            {
+                const ImS64 last = x0 + e / -dx;
+                if (last + 1 < span_x1)
+                    span_x1 = (int)(last + 1);
+            }
+        }
+        if (span_x0 >= span_x1)
+            continue;
+
+        ImU32* dst = (ImU32*)((char*)g_TargetPixels + (size_t)y * g_TargetPitch) + span_x0;
+        ImU32* dst_end = dst + (span_x1 - span_x0);
+        if (CONST_COL && BPP == 0)
+        {
+            const ImU32 src = tri.Col;
+            if ((src & IM_COL32_A_MASK) == IM_COL32_A_MASK)
+                for (; dst < dst_end; dst++)
+                    *dst = src;
+            else
+                ImGui_ImplSoftRaster_BlendSpan(dst, dst_end, src);
+            continue;
+        }
+
+        float u = 0.0f, v = 0.0f, r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
+        if (BPP != 0)
+        {
+            u = tri.Attr[0] + tri.AttrDx[0] * span_x0 + tri.AttrDy[0] * y;
+            v = tri.Attr[1] + tri.AttrDx[1] * span_x0 + tri.AttrDy[1] * y;
+        }
+        if (!CONST_COL)
+        {
+            r = tri.Attr[2] + tri.AttrDx[2] * span_x0 + tri.AttrDy[2] * y;
+            g = tri.Attr[3] + tri.AttrDx[3] * span_x0 + tri.AttrDy[3] * y;
+            b = tri.Attr[4] + tri.AttrDx[4] * span_x0 + tri.AttrDy[4] * y;
+            a = tri.Attr[5] + tri.AttrDx[5] * span_x0 + tri.AttrDy[5] * y;
+        }
+        for (; dst < dst_end; dst++)
+        {
+            ImU32 col = tri.Col;
+            if (!CONST_COL)
+            {
+                col = (ImGui_ImplSoftRaster_FloatToByte(r) << IM_COL32_R_SHIFT) | (ImGui_ImplSoftRaster_FloatToByte(g) << IM_COL32_G_SHIFT) |
+                      (ImGui_ImplSoftRaster_FloatToByte(b) << IM_COL32_B_SHIFT) | (ImGui_ImplSoftRaster_FloatToByte(a) << IM_COL32_A_SHIFT);
+                r += tri.AttrDx[2]; g += tri.AttrDx[3]; b += tri.AttrDx[4]; a += tri.AttrDx[5];
+            }
+            ImU32 src;
+            if (BPP == 0)
+            {
+                src = ImGui_ImplSoftRaster_Modulate(col, tri.Texel);
+            }
+            else
+            {
+                int tx = (int)u, ty = (int)v;
+                tx = (tx < 0) ? 0 : (tx >= tex->Width) ? tex->Width - 1 : tx;
+                ty = (ty < 0) ? 0 : (ty >= tex->Height) ? tex->Height - 1 : ty;
+                if (BPP == 1)
+                    src = ImGui_ImplSoftRaster_ModulateAlpha(col, ((const unsigned char*)tex->Pixels)[ty * tex->Width + tx]);
+                else
+                    src = ImGui_ImplSoftRaster_Modulate(col, ((const ImU32*)tex->Pixels)[ty * tex->Width + tx]);
+                u += tri.AttrDx[0]; v += tri.AttrDx[1];
+            }
+            if (src & IM_COL32_A_MASK)
+                *dst = ImGui_ImplSoftRaster_Blend(*dst, src);
+        }
+    }
+}
+
+// Render all triangles binned into a tile, in submission order
+static void ImGui_ImplSoftRaster_RenderTile(void* job_data, int job_index)
+{
+    (void)job_data;
+    const int tile_n = g_ActiveTiles[job_index];
+    const int tile_x0 = (tile_n % g_TilesCountX) << IMGUI_IMPL_SOFTRASTER_TILE_SHIFT;
+    const int tile_y0 = (tile_n / g_TilesCountX) << IMGUI_IMPL_SOFTRASTER_TILE_SHIFT;
+    const int tile_size = 1 << IMGUI_IMPL_SOFTRASTER_TILE_SHIFT;
+    for (int n = g_TileOffsets[tile_n]; n < g_TileOffsets[tile_n + 1]; n++)
+    {
+        const ImGui_ImplSoftRaster_Triangle& tri = g_Triangles[g_TileTriangles[n]];
+        const int x0 = ImGui_ImplSoftRaster_Max(tri.MinX, tile_x0), x1 = ImGui_ImplSoftRaster_Min(tri.MaxX, tile_x0 + tile_size);
+        const int y0 = ImGui_ImplSoftRaster_Max(tri.MinY, tile_y0), y1 = ImGui_ImplSoftRaster_Min(tri.MaxY, tile_y0 + tile_size);
+        const bool const_col = (tri.Flags & ImGui_ImplSoftRaster_TriangleFlags_ConstCol) != 0;
+        const int bpp = (tri.Flags & ImGui_ImplSoftRaster_TriangleFlags_ConstUV) ? 0 : tri.Texture->BytesPerPixel;
+        if (const_col)
+        {
+            if (bpp == 0)      ImGui_ImplSoftRaster_RasterizeTriangle<true, 0>(tri, x0, y0, x1, y1);
+            else if (bpp == 1) ImGui_ImplSoftRaster_RasterizeTriangle<true, 1>(tri, x0, y0, x1, y1);
+            else               ImGui_ImplSoftRaster_RasterizeTriangle<true, 4>(tri, x0, y0, x1, y1);
+        }
+        else
+        {
+            if (bpp == 0)      ImGui_ImplSoftRaster_RasterizeTriangle<false, 0>(tri, x0, y0, x1, y1);
+            else if (bpp == 1) ImGui_ImplSoftRaster_RasterizeTriangle<false, 1>(tri, x0, y0, x1, y1);
+            else               ImGui_ImplSoftRaster_RasterizeTriangle<false, 4>(tri, x0, y0, x1, y1);
+        }
+    }
+}
+
+// Bin the triangles set up so far into tiles, render them into g_TargetPixels and clear the list
+static void ImGui_ImplSoftRaster_RenderTriangles(int width, int height)
+{
+    if (g_Triangles.Size == 0)
+        return;
+
+    // Bin triangles into tiles: count, then store indices in submission order
+    const int tile_shift = IMGUI_IMPL_SOFTRASTER_TILE_SHIFT;
+    g_TilesCountX = ((width - 1) >> tile_shift) + 1;
+    const int tiles_count = g_TilesCountX * (((height - 1) >> tile_shift) + 1);
+    g_TileOffsets.resize(tiles_count + 1);
+    memset(g_TileOffsets.Data, 0, (size_t)g_TileOffsets.size_in_bytes());
+    for (int tri_n = 0; tri_n < g_Triangles.Size; tri_n++)
+    {
+        const ImGui_ImplSoftRaster_Triangle& tri = g_Triangles[tri_n];
+        for (int ty = tri.MinY >> tile_shift; ty <= (tri.MaxY - 1) >> tile_shift; ty++)
+            for (int tx = tri.MinX >> tile_shift; tx <= (tri.MaxX - 1) >> tile_shift; tx++)
+                g_TileOffsets[ty * g_TilesCountX + tx]++;
+    }
+    g_ActiveTiles.resize(0);
+    int total = 0;
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+    {
+        const int count = g_TileOffsets[tile_n];
+        if (count > 0)
+            g_ActiveTiles.push_back(tile_n);
+        g_TileOffsets[tile_n] = total;
+        total += count;
+    }
+    g_TileOffsets[tiles_count] = total;
+    g_TileCursors.resize(tiles_count);
+    memcpy(g_TileCursors.Data, g_TileOffsets.Data, (size_t)g_TileCursors.size_in_bytes());
+    g_TileTriangles.resize(total);
+    for (int tri_n = 0; tri_n < g_Triangles.Size; tri_n++)
+    {
+        const ImGui_ImplSoftRaster_Triangle& tri = g_Triangles[tri_n];
+        for (int ty = tri.MinY >> tile_shift; ty <= (tri.MaxY - 1) >> tile_shift; ty++)
+            for (int tx = tri.MinX >> tile_shift; tx <= (tri.MaxX - 1) >> tile_shift; tx++)
+                g_TileTriangles[g_TileCursors[ty * g_TilesCountX + tx]++] = tri_n;
+    }
+
+    // Render tiles
+    if (g_ParallelForFn != NULL && g_ActiveTiles.Size > 1)
+        g_ParallelForFn(ImGui_ImplSoftRaster_RenderTile, NULL, g_ActiveTiles.Size, g_ParallelForUserData);
+    else
+        for (int job_n = 0; job_n < g_ActiveTiles.Size; job_n++)
+            ImGui_ImplSoftRaster_RenderTile(NULL, job_n);
+    g_Triangles.resize(0);
+}
+
+// Software Render function.
+void    ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int pitch)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    // Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs) are sampled directly from the atlas
+    ImGui::GetIO().Fonts->TexDirtyRects.clear();
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Setup triangles, rendering them in batches separated by user callbacks
+    g_TargetPixels = pixels;
+    g_TargetPitch = pitch;
+    g_Triangles.resize(0);
+    g_Triangles.reserve(draw_data->TotalIdxCount / 3);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // Render the triangles submitted before it first, so it runs in order with them.
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                {
+                    ImGui_ImplSoftRaster_RenderTriangles(width, height);
+                    pcmd->UserCallback(cmd_list, pcmd);
+                }
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            int clip[4];
+            clip[0] = ImGui_ImplSoftRaster_Max((int)((pcmd->ClipRect.x - clip_off.x) * clip_scale.x), 0);
+            clip[1] = ImGui_ImplSoftRaster_Max((int)((pcmd->ClipRect.y - clip_off.y) * clip_scale.y), 0);
+            clip[2] = ImGui_ImplSoftRaster_Min((int)((pcmd->ClipRect.z - clip_off.x) * clip_scale.x), width);
+            clip[3] = ImGui_ImplSoftRaster_Min((int)((pcmd->ClipRect.w - clip_off.y) * clip_scale.y), height);
+            if (clip[0] >= clip[2] || clip[1] >= clip[3])
+                continue;
+
+            const ImGui_ImplSoftRaster_Texture* tex = (const ImGui_ImplSoftRaster_Texture*)pcmd->TextureId;
+            IM_ASSERT(tex != NULL && tex->Pixels != NULL && (tex->BytesPerPixel == 1 || tex->BytesPerPixel == 4));
+            const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            for (unsigned int idx_n = 0; idx_n + 2 < pcmd->ElemCount; idx_n += 3)
+                ImGui_ImplSoftRaster_SetupTriangle(&vtx_buffer[idx_buffer[idx_n]], &vtx_buffer[idx_buffer[idx_n + 1]], &vtx_buffer[idx_buffer[idx_n + 2]], tex, clip, clip_off, clip_scale);
+        }
+    }
+    ImGui_ImplSoftRaster_RenderTriangles(width, height);
+    g_TargetPixels = NULL;
+}
+
+bool    ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    // Build texture atlas: sample it directly as alpha values, so glyphs rasterized on demand don't need to be copied
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+    g_FontTexture.Pixels = pixels;
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+    g_FontTexture.BytesPerPixel = 1;
+    io.Fonts->TexDirtyRects.clear();
+
+    // Store our identifier
+    io.Fonts->TexID = (ImTextureID)&g_FontTexture;
+
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    if (g_FontTexture.Pixels)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.Fonts->TexID = 0;
+        g_FontTexture.Pixels = NULL;
+    }
+}
@@ -0,0 +1,39 @@
+// dear imgui: Renderer for a CPU software rasterizer, drawing into a 32-bit RGBA buffer in memory
+// This can be used along with a Platform Binding (e.g. GLFW, SDL, Win32, custom..) presenting the buffer, or headless
+// (e.g. to compare screenshots in tests, or to measure fill cost without depending on a GPU driver).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Multi-threaded rendering: the target is split in tiles which can be rendered in parallel by a user-provided function.
+// Missing features:
+//  [ ] Renderer: Texture sampling uses nearest filtering (text and icons are pixel aligned so this rarely matters).
+
+// You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
+// If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
+// https://github.com/ocornut/imgui
+
+#pragma once
+
+// Texture data referenced by ImTextureID. The pixels are read while rendering and are not copied.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const void*     Pixels;         // BytesPerPixel == 1: alpha values (sampled as white). BytesPerPixel == 4: ImU32 colors packed like IM_COL32().
+    int             Width;
+    int             Height;
+    int             BytesPerPixel;  // 1 or 4
+};
+
+// Run job_fn(job_data, n) for every n in [0..jobs_count), from any thread, and return when all calls are done (same as ImFontAtlas::ParallelForFn).
+typedef void (*ImGui_ImplSoftRaster_ParallelForFn)(void (*job_fn)(void* job_data, int job_index), void* job_data, int jobs_count, void* user_data);
+
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(ImGui_ImplSoftRaster_ParallelForFn parallel_for_fn = NULL, void* parallel_for_user_data = NULL);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+
+// Blend draw data over 'pixels' (ImU32 colors packed like IM_COL32(), 'pitch' bytes between rows). The buffer is not cleared.
+// Vertices are projected to (pos - draw_data->DisplayPos) * draw_data->FramebufferScale, and clipped to width x height.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int pitch);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
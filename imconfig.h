@@ -38,6 +38,9 @@
 //#define IMGUI_DISABLE_FORMAT_STRING_FUNCTIONS             // Don't implement ImFormatString/ImFormatStringV so you can implement them yourself if you don't want to link with vsnprintf.
 //#define IMGUI_DISABLE_MATH_FUNCTIONS                      // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 wrapper so you can implement them yourself. Declare your prototypes in imconfig.h.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
+//#define IMGUI_DISABLE_SIMD                                // Don't use SSE2/NEON intrinsics, even if they are available (text measurement/rendering fast paths).
+//#define IMGUI_USE_FAST_HASH                               // Hash IDs with ImHashDataFast() instead of CRC32. Faster, but all IDs are different: don't use if you store IDs persistently.
+//#define IMGUI_USE_HASHED_STORAGE                          // Index ImGuiStorage with a hash table: O(1) insertion and queries instead of a sorted array (O(N) insertion, O(log N) queries). Pairs in ImGuiStorage::Data are not sorted.
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -70,6 +73,10 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes vertex layout instead of the default 20 bytes one: 16-bit fixed-point positions (1/4 pixel precision, range -8192..+8191), 16-bit normalized UV, 32-bit color.
+// Reduces vertex bandwidth, e.g. when streaming draw data over a network. Your renderer back-end will need to support it (see ImDrawVert): only the OpenGL2/OpenGL3 example back-ends and msnc_extra/imgui_impl_opengl2.cpp do, DX9/DX10/DX11/DX12/Vulkan/Metal/Marmalade don't.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer back-ends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -69,6 +69,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
+// [SECTION] ImGuiTextLog
 // [SECTION] ImGuiListClipper
 // [SECTION] RENDER HELPERS
 // [SECTION] MAIN CODE (most of the code! lots of stuff, needs tidying up!)
@@ -369,6 +370,7 @@ CODE
  When you are not sure about a old symbol or function name, try using the Search/Find function of your IDE to look for comments or references in all imgui files.
  You can read releases logs https://github.com/ocornut/imgui/releases for more details.
 
+ - 2019/07/15 (1.72) - ImFont: IndexAdvanceX[] and IndexLookup[] are now paged (see ImFont::IndexPages) and cannot be indexed by codepoint directly. Use GetCharAdvance(), FindGlyph() or FindGlyphNoFallback() instead.
  - 2019/07/12 (1.72) - renamed ImFontAtlas::CustomRect to ImFontAtlasCustomRect. Keep redirection typedef (will obsolete).
  - 2019/06/14 (1.72) - removed redirecting functions/enums names that were marked obsolete in 1.51 (June 2017): ImGuiCol_Column*, ImGuiSetCond_*, IsItemHoveredRect(), IsPosHoveringAnyWindow(), IsMouseHoveringAnyWindow(), IsMouseHoveringWindow(), IMGUI_ONCE_UPON_A_FRAME. Grep this log for details and new names.
  - 2019/06/07 (1.71) - rendering of child window outer decorations (bg color, border, scrollbars) is now performed as part of the parent window. If you have
@@ -1043,6 +1045,10 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Extend outside and inside windows. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 
+// Large word-wrapped texts (see GetWrappedTextCache())
+static const int   WRAPPED_TEXT_CACHE_BUILD_BUDGET          = 256 * 1024; // Bytes laid out per frame for each text, in addition to what is needed to display the visible lines (~1 ms)
+static const int   WRAPPED_TEXT_CACHE_MAX_AGE               = 60;       // Caches unused for this number of frames are released
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
@@ -1057,6 +1063,7 @@ static void             AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, I
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
 
 static ImRect           GetViewportRect();
+static void             TextLayoutCacheNewFrame(ImGuiTextLayoutCache* cache, ImFontAtlas* atlas, int frame_count);
 
 // Settings
 static void*            SettingsHandlerWindow_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name);
@@ -1092,6 +1099,7 @@ static bool             UpdateManualResize(ImGuiWindow* window, const ImVec2& si
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
 static void             RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, const char* name, bool* p_open);
+static ImGuiID          CalcWindowDrawListReuseHash(ImGuiWindow* window, const char* name, bool has_close_button, const ImU32 resize_grip_col[4]);
 
 }
 
@@ -1170,7 +1178,7 @@ ImGuiStyle::ImGuiStyle()
     MouseCursorScale        = 1.0f;             // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). May be removed later.
     AntiAliasedLines        = true;             // Enable anti-aliasing on lines/borders. Disable if you are really short on CPU/GPU.
     AntiAliasedFill         = true;             // Enable anti-aliasing on filled shapes (rounded rectangles, circles, etc.)
-    CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
+    CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo(), AddCircle(), AddCircleFilled() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
 
     // Default theme
     ImGui::StyleColorsDark(this);
@@ -1239,6 +1247,7 @@ ImGuiIO::ImGuiIO()
     ConfigInputTextCursorBlink = true;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
+    ConfigDrawDataDamageRects = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1499,6 +1508,68 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_FORMAT_STRING_FUNCTIONS
 
+// Word-at-a-time hash, consuming 8 bytes per step with 64-bit multiplications instead of 1 byte per step with a table lookup.
+// This is used instead of CRC32 by ImHashData()/ImHashStr() when IMGUI_USE_FAST_HASH is defined, and always used for in-memory caches.
+// Results differ from CRC32, so don't use them for anything persistent. The implementation lives in ImGuiHashedLabel so it can run at compile-time.
+// Collisions behave like a random 32-bit hash. CRC32 is slower but can't collide for inputs of the same length differing only
+// within 4 contiguous bytes (e.g. "Item 1234" vs "Item 5678"), which is why it stays the default.
+ImU32 ImHashDataFast(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ImGuiHashedLabel::HashFastCombine(ImGuiHashedLabel::HashFast((const char*)data_p, data_size), seed);
+}
+
+// 64-bit hash for persistent data (MurmurHash64A). Bytes are read explicitly in little endian order, so results are the same on
+// all machines. Unlike ImHashDataFast() this is part of file formats: never change its results.
+ImU64 ImHashData64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const ImU64 m = 0xC6A4A7935BD1E995ULL;
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 h = seed ^ ((ImU64)data_size * m);
+    size_t i = 0;
+    for (; i + 8 <= data_size; i += 8)
+    {
+        ImU64 k = (ImU64)data[i + 0]       | (ImU64)data[i + 1] << 8  | (ImU64)data[i + 2] << 16 | (ImU64)data[i + 3] << 24 |
+                  (ImU64)data[i + 4] << 32 | (ImU64)data[i + 5] << 40 | (ImU64)data[i + 6] << 48 | (ImU64)data[i + 7] << 56;
+        k *= m;
+        k ^= k >> 47;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    if (i < data_size)
+    {
+        for (size_t n = 0; i + n < data_size; n++)
+            h ^= (ImU64)data[i + n] << (n * 8);
+        h *= m;
+    }
+    h ^= h >> 47;
+    h *= m;
+    h ^= h >> 47;
+    return h;
+}
+
+#ifdef IMGUI_USE_FAST_HASH
+
+ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ImHashDataFast(data_p, data_size, seed);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// As we don't process one character at a time, we first find the last ### and only hash what follows, which is equivalent.
+ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    for (const char* p = (const char*)memchr(data_p, '#', data_size); p != NULL && data_end - p >= 3; p = (const char*)memchr(p + 1, '#', (size_t)(data_end - p - 1)))
+        if (p[1] == '#' && p[2] == '#')
+            data_p = p;
+    return ImHashDataFast(data_p, (size_t)(data_end - data_p), seed);
+}
+
+#else
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1524,7 +1595,7 @@ static const ImU32 GCrc32LookupTable[256] =
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// Define IMGUI_USE_FAST_HASH to use ImHashDataFast() instead: CRC32 pretty much randomly access 1KB (see 'hash_ids' scenario in example_null_benchmark).
 ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
@@ -1540,7 +1611,7 @@ ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// Define IMGUI_USE_FAST_HASH to use ImHashDataFast() instead: CRC32 pretty much randomly access 1KB (see 'hash_ids' scenario in example_null_benchmark).
 ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
@@ -1569,6 +1640,46 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+#endif // #ifdef IMGUI_USE_FAST_HASH
+
+// Combine a precomputed ImGuiHashedLabel with the ID stack seed, giving the same result as ImHashStr(label.Label, 0, seed).
+// CRC32 is linear: starting from ~seed instead of ~0 adds (seed * x^(8*len)) modulo the polynomial to the result.
+// We compute this product in constant time (same as crc32_combine() in zlib, with a carry-less multiplication 4 bits at a time
+// reduced with the CRC32 table), which is only faster than hashing the characters for labels longer than a few characters.
+ImU32 ImHashHashedLabel(const ImGuiHashedLabel& label, ImU32 seed)
+{
+#ifdef IMGUI_USE_FAST_HASH
+    return ImGuiHashedLabel::HashFastCombine(label.Hash, seed);
+#else
+    if (seed == 0)
+        return (ImU32)label.Hash;
+    if (label.IdLength <= 8)
+        return ImHashData(label.Label + label.IdOffset, (size_t)label.IdLength, seed);
+
+    // Bit-reflected carry-less product of SeedFactor and seed (63 bits)
+    const ImU32 a = label.SeedFactor;
+    ImU64 a_mul[16];
+    a_mul[0] = 0;
+    a_mul[1] = a;
+    for (int n = 2; n < 16; n += 2)
+    {
+        a_mul[n] = a_mul[n >> 1] << 1;
+        a_mul[n + 1] = a_mul[n] ^ a;
+    }
+    ImU64 product = 0;
+    for (int shift = 0; shift < 32; shift += 4)
+        product ^= a_mul[(seed >> shift) & 0x0F] << shift;
+    product <<= 1;
+
+    // Reduce the high degree terms (low 32 bits in reflected order) like the CRC32 of 4 zero bytes
+    ImU32 high_terms = (ImU32)product;
+    const ImU32* crc32_lut = GCrc32LookupTable;
+    for (int n = 0; n < 4; n++)
+        high_terms = (high_terms >> 8) ^ crc32_lut[high_terms & 0xFF];
+    return (ImU32)label.Hash ^ (ImU32)(product >> 32) ^ high_terms;
+#endif
+}
+
 FILE* ImFileOpen(const char* filename, const char* mode)
 {
 #if defined(_WIN32) && !defined(__CYGWIN__) && !defined(__GNUC__)
@@ -1631,6 +1742,37 @@ void* ImFileLoadToMemory(const char* filename, const char* file_open_mode, size_
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
 
+// Find the end of a run of printable ASCII characters (0x20..0x7E), which text functions can process without decoding, 16 bytes at a time if possible.
+const char* ImTextFindPrintableAsciiEnd(const char* in_text, const char* in_text_end)
+{
+    const char* s = in_text;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128i min_minus_one = _mm_set1_epi8(0x1F);
+    const __m128i max_plus_one = _mm_set1_epi8(0x7F);
+    while (in_text_end - s >= 16)
+    {
+        // Signed comparison: bytes >= 0x80 are negative and fail the test along with control characters
+        const __m128i chars = _mm_loadu_si128((const __m128i*)(const void*)s);
+        if (_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(chars, min_minus_one), _mm_cmplt_epi8(chars, max_plus_one))) != 0xFFFF)
+            break;
+        s += 16;
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const int8x16_t min_minus_one = vdupq_n_s8(0x1F);
+    const int8x16_t max_plus_one = vdupq_n_s8(0x7F);
+    while (in_text_end - s >= 16)
+    {
+        const int8x16_t chars = vld1q_s8((const int8_t*)(const void*)s);
+        if (vminvq_u8(vandq_u8(vcgtq_s8(chars, min_minus_one), vcltq_s8(chars, max_plus_one))) == 0)
+            break;
+        s += 16;
+    }
+#endif
+    while (s < in_text_end && (unsigned char)*s >= 0x20 && (unsigned char)*s < 0x7F)
+        s++;
+    return s;
+}
+
 // Convert UTF-8 to 32-bits character, process single character input.
 // Based on stb_from_utf8() from github.com/nothings/stb/
 // We handle UTF-8 decoding error by skipping forward.
@@ -1923,6 +2065,73 @@ ImU32 ImGui::GetColorU32(ImU32 col)
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+
+// Data stays a dense array of pairs (in insertion order, until BuildSortByKey() is called) so code iterating it keeps working.
+// Index is an open-addressing hash table (linear probing, load factor <= 0.5) of indices into Data. Pairs are never removed
+// from a storage, so we don't need tombstones. Index is rebuilt if Data was modified directly, e.g. with push_back() + BuildSortByKey().
+static inline int StorageHashSlot(ImGuiID key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u; // IDs are usually hashes already, but user storage may use small sequential keys
+    return (int)((h ^ (h >> 15)) & (ImU32)mask);
+}
+
+static void StorageRebuildIndex(ImGuiStorage* storage)
+{
+    int index_size = 16;
+    while (index_size < storage->Data.Size * 2)
+        index_size <<= 1;
+    storage->Index.resize(index_size);
+    memset(storage->Index.Data, 0xFF, (size_t)storage->Index.size_in_bytes());
+    const int mask = index_size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        const ImGuiID key = storage->Data[n].key;
+        int slot = StorageHashSlot(key, mask);
+        while (storage->Index[slot] != -1 && storage->Data[storage->Index[slot]].key != key)
+            slot = (slot + 1) & mask;
+        if (storage->Index[slot] == -1) // Keep the first pair if there are duplicates
+            storage->Index[slot] = n;
+    }
+    storage->IndexedCount = storage->Data.Size;
+}
+
+// Return slot of key, or of the empty slot where it would be inserted
+static int StorageFindSlot(ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->IndexedCount != storage->Data.Size || storage->Index.Size == 0)
+        StorageRebuildIndex(storage);
+    const int mask = storage->Index.Size - 1;
+    int slot = StorageHashSlot(key, mask);
+    while (storage->Index[slot] != -1 && storage->Data[storage->Index[slot]].key != key)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* const_storage, ImGuiID key)
+{
+    ImGuiStorage* storage = const_cast<ImGuiStorage*>(const_storage);
+    if (storage->Data.Size == 0)
+        return NULL;
+    const int idx = storage->Index[StorageFindSlot(storage, key)];
+    return (idx != -1) ? &storage->Data[idx] : NULL;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    int slot = StorageFindSlot(storage, pair.key);
+    if (storage->Index[slot] != -1)
+        return &storage->Data[storage->Index[slot]];
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->Index.Size)
+        StorageRebuildIndex(storage);
+    else
+        storage->Index[slot] = storage->Data.Size - 1, storage->IndexedCount++;
+    return &storage->Data.back();
+}
+
+#else
+
 // std::lower_bound but without the bullshit
 static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
 {
@@ -1946,6 +2155,23 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = const_cast<ImVector<ImGuiStorage::ImGuiStoragePair>&>(storage->Data);
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(data, key);
+    return (it == data.end() || it->key != key) ? NULL : it;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, pair.key);
+    if (it == storage->Data.end() || it->key != pair.key)
+        it = storage->Data.insert(it, pair);
+    return it;
+}
+
+#endif // #ifdef IMGUI_USE_HASHED_STORAGE
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1961,14 +2187,15 @@ void ImGuiStorage::BuildSortByKey()
     };
     if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairCompareByID);
+#ifdef IMGUI_USE_HASHED_STORAGE
+    IndexedCount = -1; // Rebuild index on next query
+#endif
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1978,27 +2205,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2008,30 +2228,18 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2041,24 +2249,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2185,22 +2381,153 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
-void ImGuiTextBuffer::append(const char* str, const char* str_end)
+void ImGuiTextBuffer::clear()
 {
-    int len = str_end ? (int)(str_end - str) : (int)strlen(str);
+    Buf.clear();
+    for (int n = 0; n < Chunks.Size; n++)
+        IM_FREE(Chunks[n].Data);
+    Chunks.clear();
+}
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
-    const int needed_sz = write_off + len;
-    if (write_off + len >= Buf.Capacity)
+ImGuiTextBuffer& ImGuiTextBuffer::operator=(const ImGuiTextBuffer& src)
+{
+    if (this == &src)
+        return *this;
+    clear();
+    Buf = src.Buf;
+    ChunkSize = src.ChunkSize;
+    Chunks = src.Chunks;
+    for (int n = 0; n < Chunks.Size; n++)
     {
-        int new_capacity = Buf.Capacity * 2;
-        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        Chunks[n].Data = (char*)IM_ALLOC((size_t)Chunks[n].Capacity);
+        memcpy(Chunks[n].Data, src.Chunks[n].Data, (size_t)Chunks[n].Size);
     }
+    return *this;
+}
 
-    Buf.resize(needed_sz);
-    memcpy(&Buf[write_off - 1], str, (size_t)len);
-    Buf[write_off - 1 + len] = 0;
+// Return index of the chunk containing 'pos' (the last chunk for the end position)
+static int TextBufferFindChunk(const ImGuiTextBuffer* buf, int pos)
+{
+    const ImVector<ImGuiTextBuffer::ImGuiTextChunk>& chunks = buf->Chunks;
+    IM_ASSERT(chunks.Size > 0 && pos >= chunks[0].Pos && pos <= buf->end_pos());
+    if (pos >= chunks.back().Pos)
+        return chunks.Size - 1;
+    int lo = 0, hi = chunks.Size - 1; // chunks[lo].Pos <= pos < chunks[hi].Pos
+    while (hi - lo > 1)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (chunks[mid].Pos <= pos)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+const char* ImGuiTextBuffer::at(int pos) const
+{
+    if (ChunkSize == 0)
+        return begin() + pos;
+    if (Chunks.Size == 0)
+        return EmptyString;
+    const ImGuiTextChunk& chunk = Chunks[TextBufferFindChunk(this, pos)];
+    return chunk.Data + (pos - chunk.Pos);
+}
+
+// Return the space available to write at the end of the text without allocating (including room for a zero-terminator)
+static int TextBufferGetWriteSpace(ImGuiTextBuffer* buf, char** out_write_p)
+{
+    if (buf->ChunkSize == 0)
+    {
+        if (buf->Buf.Size == 0)
+            return 0;
+        *out_write_p = buf->Buf.Data + buf->Buf.Size - 1;
+        return buf->Buf.Capacity - buf->Buf.Size + 1;
+    }
+    if (buf->Chunks.Size == 0)
+        return 0;
+    ImGuiTextBuffer::ImGuiTextChunk& chunk = buf->Chunks.back();
+    *out_write_p = chunk.Data + chunk.Size;
+    return chunk.Capacity - chunk.Size;
+}
+
+// Make room to write 'len' characters + zero-terminator at the end of the text, to be followed by TextBufferCommitWrite()
+static char* TextBufferPrepareWrite(ImGuiTextBuffer* buf, int len)
+{
+    if (buf->ChunkSize == 0)
+    {
+        // Add zero-terminator the first time
+        const int write_off = (buf->Buf.Size != 0) ? buf->Buf.Size : 1;
+        const int needed_sz = write_off + len;
+        if (needed_sz >= buf->Buf.Capacity)
+        {
+            int new_capacity = buf->Buf.Capacity * 2;
+            buf->Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        }
+        return buf->Buf.Data + write_off - 1;
+    }
+
+    ImVector<ImGuiTextBuffer::ImGuiTextChunk>& chunks = buf->Chunks;
+    ImGuiTextBuffer::ImGuiTextChunk* last_chunk = chunks.Size ? &chunks.back() : NULL;
+    if (last_chunk && last_chunk->Size + len + 1 <= last_chunk->Capacity)
+        return last_chunk->Data + last_chunk->Size;
+
+    // Start a new chunk, moving the unterminated line at the end of the last chunk to it so lines are never split.
+    // When the last chunk is a single unterminated line, grow it instead.
+    ImGuiTextBuffer::ImGuiTextChunk new_chunk;
+    new_chunk.Pos = 0;
+    new_chunk.Size = new_chunk.LinesCount = 0;
+    if (last_chunk)
+    {
+        const char* line_begin = last_chunk->Data + last_chunk->Size;
+        while (line_begin > last_chunk->Data && line_begin[-1] != '\n')
+            line_begin--;
+        new_chunk.Size = (int)(last_chunk->Data + last_chunk->Size - line_begin);
+        new_chunk.Pos = last_chunk->Pos + last_chunk->Size - new_chunk.Size;
+        if (new_chunk.Size == last_chunk->Size)
+        {
+            const int new_capacity = ImMax(last_chunk->Capacity * 2, last_chunk->Size + len + 1);
+            char* new_data = (char*)IM_ALLOC((size_t)new_capacity);
+            memcpy(new_data, last_chunk->Data, (size_t)last_chunk->Size);
+            IM_FREE(last_chunk->Data);
+            last_chunk->Data = new_data;
+            last_chunk->Capacity = new_capacity;
+            return last_chunk->Data + last_chunk->Size;
+        }
+    }
+    new_chunk.Capacity = ImMax(buf->ChunkSize, new_chunk.Size + len + 1);
+    new_chunk.Data = (char*)IM_ALLOC((size_t)new_chunk.Capacity);
+    if (new_chunk.Size > 0)
+    {
+        last_chunk->Size -= new_chunk.Size;
+        memcpy(new_chunk.Data, last_chunk->Data + last_chunk->Size, (size_t)new_chunk.Size);
+    }
+    chunks.push_back(new_chunk);
+    return chunks.back().Data + new_chunk.Size;
+}
+
+static void TextBufferCommitWrite(ImGuiTextBuffer* buf, int len)
+{
+    if (buf->ChunkSize == 0)
+    {
+        const int write_off = (buf->Buf.Size != 0) ? buf->Buf.Size : 1;
+        buf->Buf.resize(write_off + len);
+        buf->Buf.Data[write_off - 1 + len] = 0;
+        return;
+    }
+    ImGuiTextBuffer::ImGuiTextChunk& chunk = buf->Chunks.back();
+    for (const char* p = chunk.Data + chunk.Size, *p_end = p + len; (p = (const char*)memchr(p, '\n', (size_t)(p_end - p))) != NULL; p++)
+        chunk.LinesCount++;
+    chunk.Size += len;
+}
+
+void ImGuiTextBuffer::append(const char* str, const char* str_end)
+{
+    int len = str_end ? (int)(str_end - str) : (int)strlen(str);
+    if (len == 0 && ChunkSize != 0)
+        return;
+    memcpy(TextBufferPrepareWrite(this, len), str, (size_t)len);
+    TextBufferCommitWrite(this, len);
 }
 
 void ImGuiTextBuffer::appendf(const char* fmt, ...)
@@ -2217,25 +2544,309 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_list args_copy;
     va_copy(args_copy, args);
 
-    int len = ImFormatStringV(NULL, 0, fmt, args);         // FIXME-OPT: could do a first pass write attempt, likely successful on first pass.
-    if (len <= 0)
+    // First attempt to format in the remaining capacity, which is likely to succeed unless the buffer is empty or full.
+    // (The output may have been truncated when it fills the whole space, as ImFormatStringV() doesn't tell us)
+    char* write_p = NULL;
+    const int write_space = TextBufferGetWriteSpace(this, &write_p);
+    int len = (write_space > 0) ? ImFormatStringV(write_p, (size_t)write_space, fmt, args) : -1;
+    if (len < 0 || len + 1 >= write_space)
+    {
+        // Measure then format after making room
+        va_list args_copy2;
+        va_copy(args_copy2, args_copy);
+        len = ImFormatStringV(NULL, 0, fmt, args_copy);
+        if (len > 0)
+            ImFormatStringV(TextBufferPrepareWrite(this, len), (size_t)len + 1, fmt, args_copy2);
+        else if (write_space > 0)
+            *write_p = 0; // Restore zero-terminator
+        va_end(args_copy2);
+    }
+    va_end(args_copy);
+    if (len > 0)
+        TextBufferCommitWrite(this, len);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTextLog
+//-----------------------------------------------------------------------------
+
+ImGuiTextLog::ImGuiTextLog()
+{
+    MaxSize = 0;
+    FilterInputBuf[0] = 0;
+    FilterLinesPerFrame = 100000;
+    AutoScroll = true;
+    QueueWritePos = QueueReadPos = QueueDroppedCount = 0;
+    Clear();
+}
+
+void ImGuiTextLog::Clear()
+{
+    Buf.clear();
+    LineOffsets.resize(0);
+    LineOffsets.push_back(0);
+    LineFirst = 0;
+    FilteredLines.resize(0);
+    FilteredFirst = 0;
+    FilteredLinesScanned = 0;
+    ScrollToBottom = false;
+}
+
+// Index lines terminated by text appended since 'old_end_pos', then remove the oldest lines if exceeding MaxSize
+static void TextLogOnAppend(ImGuiTextLog* log, int old_end_pos)
+{
+    ImGuiTextBuffer& buf = log->Buf;
+    const int end_pos = buf.end_pos();
+    for (int pos = old_end_pos; pos < end_pos; )
     {
-        va_end(args_copy);
+        // Text is contiguous within each chunk
+        int run_end_pos = end_pos;
+        if (buf.ChunkSize > 0)
+        {
+            const ImGuiTextBuffer::ImGuiTextChunk& chunk = buf.Chunks[TextBufferFindChunk(&buf, pos)];
+            run_end_pos = chunk.Pos + chunk.Size;
+        }
+        const char* run_begin = buf.at(pos);
+        const char* run_end = run_begin + (run_end_pos - pos);
+        for (const char* p = run_begin; (p = (const char*)memchr(p, '\n', (size_t)(run_end - p))) != NULL; p++)
+            log->LineOffsets.push_back(pos + (int)(p - run_begin) + 1);
+        pos = run_end_pos;
+    }
+    if (log->AutoScroll)
+        log->ScrollToBottom = true;
+    if (log->MaxSize <= 0)
         return;
+
+    // Remove lines from the front (never the current line), only advancing indices
+    while (log->LineFirst < log->LineOffsets.Size - 1 && end_pos - log->LineOffsets[log->LineFirst] > log->MaxSize)
+        log->LineFirst++;
+    while (log->FilteredFirst < log->FilteredLines.Size && log->FilteredLines[log->FilteredFirst] < log->LineFirst)
+        log->FilteredFirst++;
+    if (log->FilteredLinesScanned < log->LineFirst)
+        log->FilteredLinesScanned = log->LineFirst;
+
+    int removed_size;
+    if (buf.ChunkSize > 0)
+    {
+        // Release chunks before the first line right away, they don't need to be copied.
+        int chunks_released = 0;
+        while (chunks_released < buf.Chunks.Size - 1 && buf.Chunks[chunks_released].Pos + buf.Chunks[chunks_released].Size <= log->LineOffsets[log->LineFirst])
+            IM_FREE(buf.Chunks[chunks_released++].Data);
+        if (chunks_released > 0)
+            buf.Chunks.erase(buf.Chunks.Data, buf.Chunks.Data + chunks_released);
+
+        // Compact indices once removed lines outnumber remaining lines, rebasing positions on the first chunk
+        if (log->LineFirst == 0 || log->LineFirst < log->LineOffsets.Size - log->LineFirst)
+            return;
+        removed_size = buf.Chunks[0].Pos;
+        for (int n = 0; n < buf.Chunks.Size; n++)
+            buf.Chunks[n].Pos -= removed_size;
+    }
+    else
+    {
+        // Discard removed text once it is larger than the remaining text, so the copy cost is amortized and memory stays under 2x MaxSize
+        removed_size = log->LineOffsets[log->LineFirst];
+        if (removed_size == 0 || removed_size < end_pos - removed_size)
+            return;
+        ImVector<char>& chars = buf.Buf;
+        memmove(chars.Data, chars.Data + removed_size, (size_t)(chars.Size - removed_size)); // Including zero-terminator
+        chars.resize(chars.Size - removed_size);
     }
+    for (int n = log->LineFirst; n < log->LineOffsets.Size; n++)
+        log->LineOffsets[n - log->LineFirst] = log->LineOffsets[n] - removed_size;
+    log->LineOffsets.resize(log->LineOffsets.Size - log->LineFirst);
+    for (int n = log->FilteredFirst; n < log->FilteredLines.Size; n++)
+        log->FilteredLines[n - log->FilteredFirst] = log->FilteredLines[n] - log->LineFirst;
+    log->FilteredLines.resize(log->FilteredLines.Size - log->FilteredFirst);
+    log->FilteredLinesScanned -= log->LineFirst;
+    log->LineFirst = log->FilteredFirst = 0;
+}
+
+void ImGuiTextLog::Append(const char* str, const char* str_end)
+{
+    const int old_end_pos = Buf.end_pos();
+    Buf.append(str, str_end);
+    TextLogOnAppend(this, old_end_pos);
+}
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
-    const int needed_sz = write_off + len;
-    if (write_off + len >= Buf.Capacity)
+void ImGuiTextLog::Appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    Appendfv(fmt, args);
+    va_end(args);
+}
+
+void ImGuiTextLog::Appendfv(const char* fmt, va_list args)
+{
+    const int old_end_pos = Buf.end_pos();
+    Buf.appendfv(fmt, args);
+    TextLogOnAppend(this, old_end_pos);
+}
+
+int ImGuiTextLog::UpdateFilteredLines(const ImGuiTextFilter* filter)
+{
+    // Restart from the first line when the filter changes
+    if (strcmp(FilterInputBuf, filter->InputBuf) != 0)
     {
-        int new_capacity = Buf.Capacity * 2;
-        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        ImStrncpy(FilterInputBuf, filter->InputBuf, IM_ARRAYSIZE(FilterInputBuf));
+        FilteredLines.resize(0);
+        FilteredFirst = 0;
+        FilteredLinesScanned = LineFirst;
     }
 
-    Buf.resize(needed_sz);
-    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
-    va_end(args_copy);
+    // Test terminated lines which haven't been tested yet. They never change until they are removed.
+    const int terminated_lines_end = LineOffsets.Size - 1;
+    int scan_end = terminated_lines_end;
+    if (FilterLinesPerFrame > 0 && scan_end - FilteredLinesScanned > FilterLinesPerFrame)
+        scan_end = FilteredLinesScanned + FilterLinesPerFrame;
+    for (int line_no = FilteredLinesScanned; line_no < scan_end; line_no++)
+        if (filter->PassFilter(GetLineBegin(line_no - LineFirst), GetLineEnd(line_no - LineFirst)))
+            FilteredLines.push_back(line_no);
+    FilteredLinesScanned = scan_end;
+
+    // The current line can still be appended to, so it is tested every time
+    const int filtered_count = FilteredLines.Size - FilteredFirst;
+    if (FilteredLinesScanned == terminated_lines_end && LineOffsets[terminated_lines_end] < Buf.end_pos())
+        if (filter->PassFilter(GetLineBegin(terminated_lines_end - LineFirst), GetLineEnd(terminated_lines_end - LineFirst)))
+            return filtered_count + 1;
+    return filtered_count;
+}
+
+void ImGuiTextLog::Draw(const char* str_id, const ImGuiTextFilter* filter, const ImVec2& size)
+{
+    DrainQueue();
+    if (!ImGui::BeginChild(str_id, size, false, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    const bool use_filter = (filter != NULL && filter->IsActive());
+    const int lines_count = use_filter ? UpdateFilteredLines(filter) : GetLineCount();
+
+    // All lines have the same height so we can clip without measuring them. Filtered lines are accessed through FilteredLines[],
+    // the last one being the current line when it passes the filter (see UpdateFilteredLines()).
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
+    ImGuiListClipper clipper(lines_count, ImGui::GetTextLineHeight());
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const int line_no = !use_filter ? n : (FilteredFirst + n < FilteredLines.Size) ? FilteredLines[FilteredFirst + n] - LineFirst : LineOffsets.Size - 1 - LineFirst;
+            ImGui::TextUnformatted(GetLineBegin(line_no), GetLineEnd(line_no));
+        }
+    ImGui::PopStyleVar();
+
+    if (ScrollToBottom)
+        ImGui::SetScrollHereY(1.0f);
+    ScrollToBottom = false;
+    ImGui::EndChild();
+}
+
+// Queue records are a header (text length + flags) followed by the text, padded to ImU32 units. Records are never split:
+// when a record doesn't fit before the end of the ring buffer, a padding record skips to the beginning.
+// Producers reserve space by advancing QueueWritePos, write the text, then publish the record by writing its header.
+// DrainQueue() consumes published records in order, and zero-clears them before advancing QueueReadPos.
+#define TEXTLOG_RECORD_PUBLISHED    0x80000000
+#define TEXTLOG_RECORD_PADDING      0x40000000
+#define TEXTLOG_RECORD_LEN_MASK     0x3FFFFFFF
+
+void ImGuiTextLog::SetQueueSize(int size_in_bytes)
+{
+    IM_ASSERT(size_in_bytes > 0);
+    DrainQueue();
+    Queue.resize(ImUpperPowerOfTwo(ImMax(size_in_bytes / 4, 16)));
+    memset(Queue.Data, 0, (size_t)Queue.size_in_bytes());
+    QueueWritePos = QueueReadPos = 0;
+}
+
+bool ImGuiTextLog::Push(const char* str, const char* str_end)
+{
+    IM_ASSERT(Queue.Size > 0 && "Call SetQueueSize() before Push()!");
+    const ImU32 len = str_end ? (ImU32)(str_end - str) : (ImU32)strlen(str);
+    const ImU32 record_size = 1 + (len + 3) / 4;
+    const ImU32 queue_size = (ImU32)Queue.Size;
+    const ImU32 queue_mask = queue_size - 1;
+
+    // Reserve record (and padding when wrapping around)
+    ImU32 write_pos, padding_size;
+    for (;;)
+    {
+        const ImU32 read_pos = ImAtomicLoad(&QueueReadPos); // Load first so it is never ahead of write_pos
+        write_pos = ImAtomicLoad(&QueueWritePos);
+        const ImU32 size_to_end = queue_size - (write_pos & queue_mask);
+        padding_size = (record_size <= size_to_end) ? 0 : size_to_end;
+        if (write_pos + padding_size + record_size - read_pos > queue_size)
+        {
+            ImAtomicFetchAdd(&QueueDroppedCount, 1);
+            return false;
+        }
+        if (ImAtomicCompareExchange(&QueueWritePos, write_pos, write_pos + padding_size + record_size))
+            break;
+    }
+
+    // Write and publish
+    if (padding_size > 0)
+    {
+        ImAtomicStore(&Queue.Data[write_pos & queue_mask], TEXTLOG_RECORD_PUBLISHED | TEXTLOG_RECORD_PADDING);
+        write_pos += padding_size;
+    }
+    ImU32* record = &Queue.Data[write_pos & queue_mask];
+    memcpy(record + 1, str, (size_t)len);
+    ImAtomicStore(record, TEXTLOG_RECORD_PUBLISHED | len);
+    return true;
+}
+
+bool ImGuiTextLog::Pushf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    bool ret = Pushfv(fmt, args);
+    va_end(args);
+    return ret;
+}
+
+bool ImGuiTextLog::Pushfv(const char* fmt, va_list args)
+{
+    char buf[1024];
+    int len = ImFormatStringV(buf, IM_ARRAYSIZE(buf), fmt, args);
+    return Push(buf, buf + len);
+}
+
+int ImGuiTextLog::DrainQueue()
+{
+    if (Queue.Size == 0)
+        return 0;
+    const ImU32 queue_size = (ImU32)Queue.Size;
+    const ImU32 queue_mask = queue_size - 1;
+    const int old_end_pos = Buf.end_pos();
+    ImU32 read_pos = QueueReadPos;
+    for (;;)
+    {
+        // Records are published in any order, but consumed in order: stop at the first one still being written.
+        ImU32* record = &Queue.Data[read_pos & queue_mask];
+        const ImU32 header = ImAtomicLoad(record);
+        if (!(header & TEXTLOG_RECORD_PUBLISHED))
+            break;
+        ImU32 record_size;
+        if (header & TEXTLOG_RECORD_PADDING)
+        {
+            record_size = queue_size - (read_pos & queue_mask);
+        }
+        else
+        {
+            const ImU32 len = header & TEXTLOG_RECORD_LEN_MASK;
+            Buf.append((const char*)(record + 1), (const char*)(record + 1) + len);
+            record_size = 1 + (len + 3) / 4;
+        }
+        memset(record, 0, (size_t)record_size * sizeof(ImU32));
+        read_pos += record_size;
+        ImAtomicStore(&QueueReadPos, read_pos);
+    }
+    const int appended_size = Buf.end_pos() - old_end_pos;
+    if (appended_size > 0)
+        TextLogOnAppend(this, old_end_pos);
+    return appended_size;
 }
 
 //-----------------------------------------------------------------------------
@@ -2505,7 +3116,7 @@ void    ImGui::RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min,
         const char* text_end_ellipsis = NULL;
 
         float text_width = ImMax((pos_max.x - ellipsis_width) - pos_min.x, 1.0f);
-        float text_size_clipped_x = font->CalcTextSizeA(font_size, text_width, 0.0f, text, text_end_full, &text_end_ellipsis).x;
+        float text_size_clipped_x = CalcTextSizeCached(font, font_size, text_width, 0.0f, text, text_end_full, &text_end_ellipsis).x;
         if (text == text_end_ellipsis && text_end_ellipsis < text_end_full)
         {
             // Always display at least 1 character if there's no room for character + ellipsis
@@ -2516,7 +3127,7 @@ void    ImGui::RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min,
         {
             // Trim trailing space before ellipsis
             text_end_ellipsis--;
-            text_size_clipped_x -= font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, text_end_ellipsis, text_end_ellipsis + 1).x; // Ascii blanks are always 1 byte
+            text_size_clipped_x -= font->GetCharAdvance((ImWchar)*text_end_ellipsis) * (font_size / font->FontSize); // Ascii blanks are always 1 byte
         }
         RenderTextClippedEx(draw_list, pos_min, ImVec2(clip_max_x, pos_max.y), text, text_end_ellipsis, &text_size, ImVec2(0.0f, 0.0f));
 
@@ -2652,7 +3263,7 @@ void ImGui::RenderNavHighlight(const ImRect& bb, ImGuiID id, ImGuiNavHighlightFl
 
 // ImGuiWindow is mostly a dumb struct. It merely has a constructor and a few helper methods
 ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
-    : DrawListInst(&context->DrawListSharedData)
+    : DrawListInst(&context->DrawListSharedData), DrawListDiscard(&context->DrawListSharedData)
 {
     Name = ImStrdup(name);
     ID = ImHashStr(name);
@@ -2700,6 +3311,8 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
+    DrawListReuseHash = 0;
+    DrawListReused = false;
     ParentWindow = NULL;
     RootWindow = NULL;
     RootWindowForTitleBarHighlight = NULL;
@@ -2742,6 +3355,14 @@ ImGuiID ImGuiWindow::GetID(int n)
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiHashedLabel& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashHashedLabel(label, seed);
+    ImGui::KeepAliveID(id);
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetIDNoKeepAlive(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
@@ -2760,6 +3381,12 @@ ImGuiID ImGuiWindow::GetIDNoKeepAlive(int n)
     return ImHashData(&n, sizeof(n), seed);
 }
 
+ImGuiID ImGuiWindow::GetIDNoKeepAlive(const ImGuiHashedLabel& label)
+{
+    ImGuiID seed = IDStack.back();
+    return ImHashHashedLabel(label, seed);
+}
+
 // This is only used in rare/specific situations to manufacture an ID out of nowhere.
 ImGuiID ImGuiWindow::GetIDFromRectangle(const ImRect& r_abs)
 {
@@ -3202,6 +3829,13 @@ void ImGui::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data
     GImAllocatorUserData = user_data;
 }
 
+void ImGui::GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data)
+{
+    *p_alloc_func = GImAllocatorAllocFunc;
+    *p_free_func = GImAllocatorFreeFunc;
+    *p_user_data = GImAllocatorUserData;
+}
+
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
@@ -3624,13 +4258,21 @@ void ImGui::NewFrame()
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
+    g.StyleHash = 0;
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    TextLayoutCacheNewFrame(&g.TextLayoutCache, g.IO.Fonts, g.FrameCount);
+    for (int n = g.WrappedTextCaches.Size - 1; n >= 0; n--)
+        if (g.WrappedTextCaches[n]->LastFrameUsed < g.FrameCount - WRAPPED_TEXT_CACHE_MAX_AGE)
+        {
+            IM_DELETE(g.WrappedTextCaches[n]);
+            g.WrappedTextCaches.erase(g.WrappedTextCaches.Data + n);
+        }
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
-    g.DrawListSharedData.CurveTessellationTol = g.Style.CurveTessellationTol;
+    g.DrawListSharedData.SetCurveTessellationTol(g.Style.CurveTessellationTol);
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
@@ -3853,6 +4495,10 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ForegroundDrawList.ClearFreeMemory();
     g.PrivateClipboard.clear();
     g.InputTextState.ClearFreeMemory();
+    g.TextLayoutCache.Clear();
+    for (int i = 0; i < g.WrappedTextCaches.Size; i++)
+        IM_DELETE(g.WrappedTextCaches[i]);
+    g.WrappedTextCaches.clear();
 
     for (int i = 0; i < g.SettingsWindows.Size; i++)
         IM_DELETE(g.SettingsWindows[i].Name);
@@ -3998,6 +4644,190 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     }
 }
 
+static bool IsSameRect(const ImRect& a, const ImRect& b)
+{
+    return a.Min.x == b.Min.x && a.Min.y == b.Min.y && a.Max.x == b.Max.x && a.Max.y == b.Max.y;
+}
+
+// Compare the copies of draw list contents made by BuildDamageRects() for two frames
+static bool DamageInfoIsSameContents(const ImDrawDataBuilder* builder, const ImDrawListDamageInfo& a, const ImDrawListDamageInfo& b)
+{
+    if (a.VtxCount != b.VtxCount || a.IdxCount != b.IdxCount || a.CmdCount != b.CmdCount)
+        return false;
+    if (memcmp(builder->DamageVtx[0].Data + a.VtxStart, builder->DamageVtx[1].Data + b.VtxStart, (size_t)a.VtxCount * sizeof(ImDrawVert)) != 0)
+        return false;
+    if (memcmp(builder->DamageIdx[0].Data + a.IdxStart, builder->DamageIdx[1].Data + b.IdxStart, (size_t)a.IdxCount * sizeof(ImDrawIdx)) != 0)
+        return false;
+    for (int cmd_n = 0; cmd_n < a.CmdCount; cmd_n++)
+    {
+        const ImDrawCmd& cmd_a = builder->DamageCmds[0][a.CmdStart + cmd_n];
+        const ImDrawCmd& cmd_b = builder->DamageCmds[1][b.CmdStart + cmd_n];
+        if (memcmp(&cmd_a.ClipRect, &cmd_b.ClipRect, sizeof(cmd_a.ClipRect)) != 0 || cmd_a.TextureId != cmd_b.TextureId || cmd_a.ElemCount != cmd_b.ElemCount || cmd_a.VtxOffset != cmd_b.VtxOffset)
+            return false;
+    }
+    return true;
+}
+
+// Compare draw lists with the ones rendered by the previous frame (io.ConfigDrawDataDamageRects) and output the regions which changed in draw_data->DamageRects[].
+// - A draw list is identified by its pointer and compared using a hash of its vertices, indices and commands, and the bounding box of its vertices.
+//   A copy of the contents is kept for the next frame: when hashes are equal, contents are compared byte for byte so a hash collision can't hide a change.
+// - Draw lists which appeared, disappeared, changed or were moved behind another one damage their previous and current bounding boxes.
+// - Changing the display size or framebuffer scale, and draw lists with user callbacks, damage the whole display.
+// - Overlapping rectangles are merged, coordinates are rounded outward to integers.
+void ImDrawDataBuilder::BuildDamageRects(ImDrawData* draw_data, bool track_damage)
+{
+    const ImRect display_rect(draw_data->DisplayPos, draw_data->DisplayPos + draw_data->DisplaySize);
+    DamageRects.resize(0);
+    if (!track_damage)
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(DamageInfo); n++)
+        {
+            DamageInfo[n].resize(0);
+            DamageVtx[n].resize(0);
+            DamageIdx[n].resize(0);
+            DamageCmds[n].resize(0);
+        }
+        DamageInfoValid = false;
+        DamageRects.push_back(display_rect.ToVec4());
+        draw_data->DamageRects = DamageRects.Data;
+        draw_data->DamageRectsCount = DamageRects.Size;
+        return;
+    }
+
+    // Previous frame's draw lists are in DamageInfo[1], lookup them by pointer
+    DamageInfo[0].swap(DamageInfo[1]);
+    DamageVtx[0].swap(DamageVtx[1]);
+    DamageIdx[0].swap(DamageIdx[1]);
+    DamageCmds[0].swap(DamageCmds[1]);
+    ImVector<ImDrawListDamageInfo>& curr_infos = DamageInfo[0];
+    ImVector<ImDrawListDamageInfo>& prev_infos = DamageInfo[1];
+    curr_infos.resize(0);
+    DamageVtx[0].resize(0);
+    DamageIdx[0].resize(0);
+    DamageCmds[0].resize(0);
+    DamageInfoMap.Clear();
+    for (int n = 0; n < prev_infos.Size; n++)
+        DamageInfoMap.SetInt(ImHashData(&prev_infos[n].DrawList, sizeof(ImDrawList*)), n + 1);
+    bool damage_all = !DamageInfoValid || !IsSameRect(display_rect, DamageDisplayRect) || draw_data->FramebufferScale.x != DamageFramebufferScale.x || draw_data->FramebufferScale.y != DamageFramebufferScale.y;
+
+    int prev_order_max = -1;
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+    {
+        ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        ImDrawListDamageInfo info;
+        info.DrawList = draw_list;
+        info.CanCompare = true;
+        info.Matched = false;
+
+        // Hash and copy commands, bounding box of the area they can draw to
+        ImU32 hash = ImHashDataFast(&draw_list->CmdBuffer.Size, sizeof(int));
+        ImRect clip_rect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        info.CmdStart = DamageCmds[0].Size;
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+            if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                info.CanCompare = false;
+            if (cmd.ElemCount == 0)
+                continue;
+            DamageCmds[0].push_back(cmd);
+            hash = ImHashDataFast(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+            hash = ImHashDataFast(&cmd.TextureId, sizeof(cmd.TextureId), hash);
+            hash = ImHashDataFast(&cmd.ElemCount, sizeof(cmd.ElemCount), hash);
+            hash = ImHashDataFast(&cmd.VtxOffset, sizeof(cmd.VtxOffset), hash);
+            clip_rect.Add(ImRect(cmd.ClipRect));
+        }
+        hash = ImHashDataFast(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashDataFast(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        info.Hash = hash;
+        info.CmdCount = DamageCmds[0].Size - info.CmdStart;
+
+        // Copy vertices and indices
+        info.VtxStart = DamageVtx[0].Size;
+        info.VtxCount = draw_list->VtxBuffer.Size;
+        DamageVtx[0].resize(info.VtxStart + info.VtxCount);
+        if (info.VtxCount > 0)
+            memcpy(DamageVtx[0].Data + info.VtxStart, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+        info.IdxStart = DamageIdx[0].Size;
+        info.IdxCount = draw_list->IdxBuffer.Size;
+        DamageIdx[0].resize(info.IdxStart + info.IdxCount);
+        if (info.IdxCount > 0)
+            memcpy(DamageIdx[0].Data + info.IdxStart, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+
+        // Bounding box of vertices
+        ImRect bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int vtx_n = 0; vtx_n < draw_list->VtxBuffer.Size; vtx_n++)
+            bb.Add(ImVec2(draw_list->VtxBuffer.Data[vtx_n].pos));
+        bb.ClipWith(clip_rect);
+        bb.ClipWith(display_rect);
+        if (bb.Min.x < bb.Max.x && bb.Min.y < bb.Max.y)
+            info.Rect = ImRect(ImFloorStd(bb.Min.x), ImFloorStd(bb.Min.y), ImCeil(bb.Max.x), ImCeil(bb.Max.y));
+        else
+            info.Rect = ImRect(); // Nothing visible (inverted rectangle)
+        if (!info.CanCompare)
+            damage_all = true;
+
+        // Compare with previous frame
+        const int prev_n = DamageInfoMap.GetInt(ImHashData(&draw_list, sizeof(ImDrawList*)), 0) - 1;
+        ImDrawListDamageInfo* prev_info = (prev_n >= 0 && prev_infos[prev_n].DrawList == draw_list) ? &prev_infos[prev_n] : NULL;
+        if (prev_info == NULL)
+        {
+            if (!info.Rect.IsInverted())
+                DamageRects.push_back(info.Rect.ToVec4());
+        }
+        else
+        {
+            prev_info->Matched = true;
+            if (prev_info->Hash != info.Hash || !IsSameRect(prev_info->Rect, info.Rect) || !DamageInfoIsSameContents(this, info, *prev_info))
+            {
+                if (!prev_info->Rect.IsInverted())
+                    DamageRects.push_back(prev_info->Rect.ToVec4());
+                if (!info.Rect.IsInverted())
+                    DamageRects.push_back(info.Rect.ToVec4());
+            }
+            else if (prev_n < prev_order_max && !info.Rect.IsInverted())
+            {
+                DamageRects.push_back(info.Rect.ToVec4()); // Now rendered over a draw list which was rendered over it
+            }
+            prev_order_max = ImMax(prev_order_max, prev_n);
+        }
+        curr_infos.push_back(info);
+    }
+    for (int n = 0; n < prev_infos.Size; n++)
+        if (!prev_infos[n].Matched && !prev_infos[n].Rect.IsInverted())
+            DamageRects.push_back(prev_infos[n].Rect.ToVec4());
+    for (int n = 0; n < curr_infos.Size; n++)
+        curr_infos[n].Matched = false;
+    DamageDisplayRect = display_rect;
+    DamageFramebufferScale = draw_data->FramebufferScale;
+    DamageInfoValid = true;
+
+    if (damage_all)
+    {
+        DamageRects.resize(0);
+        DamageRects.push_back(display_rect.ToVec4());
+    }
+
+    // Merge overlapping or touching rectangles
+    for (int i = 0; i < DamageRects.Size; i++)
+    {
+        ImRect r_i(DamageRects[i]);
+        for (int j = i + 1; j < DamageRects.Size; j++)
+        {
+            const ImRect r_j(DamageRects[j]);
+            if (r_j.Min.x > r_i.Max.x || r_j.Max.x < r_i.Min.x || r_j.Min.y > r_i.Max.y || r_j.Max.y < r_i.Min.y)
+                continue;
+            r_i.Add(r_j);
+            DamageRects[j] = DamageRects.back();
+            DamageRects.pop_back();
+            j = i; // The grown rectangle may now overlap rectangles we already checked
+        }
+        DamageRects[i] = r_i.ToVec4();
+    }
+    draw_data->DamageRects = DamageRects.Size > 0 ? DamageRects.Data : NULL;
+    draw_data->DamageRectsCount = DamageRects.Size;
+}
+
 // When using this function it is sane to ensure that float are perfectly rounded to integer values, to that e.g. (int)(max.x-min.x) in user's render produce correct result.
 void ImGui::PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect)
 {
@@ -4143,6 +4973,7 @@ void ImGui::Render()
 
     // Setup ImDrawData structure for end-user
     SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
+    g.DrawDataBuilder.BuildDamageRects(&g.DrawData, g.IO.ConfigDrawDataDamageRects);
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
     g.IO.MetricsRenderIndices = g.DrawData.TotalIdxCount;
 
@@ -4169,7 +5000,7 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    ImVec2 text_size = CalcTextSizeCached(font, font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     text_size.x = (float)(int)(text_size.x + 0.95f);
@@ -4177,6 +5008,290 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+static void TextLayoutCacheUnlink(ImGuiTextLayoutCache* cache, int idx)
+{
+    ImGuiTextLayoutCacheEntry& entry = cache->Entries[idx];
+    if (entry.LruPrev != -1) cache->Entries[entry.LruPrev].LruNext = entry.LruNext; else cache->LruHead = entry.LruNext;
+    if (entry.LruNext != -1) cache->Entries[entry.LruNext].LruPrev = entry.LruPrev; else cache->LruTail = entry.LruPrev;
+    entry.LruPrev = entry.LruNext = -1;
+}
+
+static void TextLayoutCacheLinkFront(ImGuiTextLayoutCache* cache, int idx)
+{
+    ImGuiTextLayoutCacheEntry& entry = cache->Entries[idx];
+    entry.LruPrev = -1;
+    entry.LruNext = cache->LruHead;
+    if (cache->LruHead != -1) cache->Entries[cache->LruHead].LruPrev = idx; else cache->LruTail = idx;
+    cache->LruHead = idx;
+}
+
+static void TextLayoutCacheEvict(ImGuiTextLayoutCache* cache, int idx)
+{
+    TextLayoutCacheUnlink(cache, idx);
+    ImGuiTextLayoutCacheEntry& entry = cache->Entries[idx];
+    int* p_idx = &cache->Buckets[entry.Key & (cache->Buckets.Size - 1)];
+    while (*p_idx != idx)
+        p_idx = &cache->Entries[*p_idx].HashNext;
+    *p_idx = entry.HashNext;
+    cache->TextBufUnused += entry.TextLen;
+    entry.HashNext = cache->FreeIdx;
+    cache->FreeIdx = idx;
+    cache->Count--;
+    cache->Evictions++;
+}
+
+// Move texts of live entries to the beginning of a new buffer, dropping texts of evicted entries.
+static void TextLayoutCacheCompactTextBuf(ImGuiTextLayoutCache* cache)
+{
+    ImVector<char> text_buf;
+    text_buf.reserve(cache->TextBuf.Capacity);
+    text_buf.resize(cache->TextBuf.Size - cache->TextBufUnused);
+    int offset = 0;
+    for (int idx = cache->LruHead; idx != -1; idx = cache->Entries[idx].LruNext)
+    {
+        ImGuiTextLayoutCacheEntry& entry = cache->Entries[idx];
+        memcpy(text_buf.Data + offset, cache->TextBuf.Data + entry.TextOffset, (size_t)entry.TextLen);
+        entry.TextOffset = offset;
+        offset += entry.TextLen;
+    }
+    IM_ASSERT(offset == text_buf.Size);
+    cache->TextBuf.swap(text_buf);
+    cache->TextBufUnused = 0;
+}
+
+// Called by NewFrame(): evict entries from the least recently used end, within the per-frame budget.
+static void TextLayoutCacheNewFrame(ImGuiTextLayoutCache* cache, ImFontAtlas* atlas, int frame_count)
+{
+    // Invalidate everything when fonts have been rebuilt (see ImFontAtlas::BuildId)
+    // (if you modify glyphs advances manually, call ClearTextLayoutCache())
+    if (cache->AtlasBuildId != atlas->BuildId || (cache->Buckets.Size > 0 && cache->Buckets.Size < cache->Capacity))
+    {
+        cache->AtlasBuildId = atlas->BuildId;
+        cache->Clear();
+    }
+
+    cache->HitsLastFrame = cache->Hits;
+    cache->MissesLastFrame = cache->Misses;
+    cache->EvictionsLastFrame = cache->Evictions;
+    cache->Hits = cache->Misses = cache->Evictions = 0;
+    while (cache->LruTail != -1 && cache->Evictions < cache->EvictionBudget)
+    {
+        const ImGuiTextLayoutCacheEntry& entry = cache->Entries[cache->LruTail];
+        if (cache->Count <= cache->Capacity && entry.LastFrameUsed >= frame_count - cache->MaxAge)
+            break;
+        TextLayoutCacheEvict(cache, cache->LruTail);
+    }
+}
+
+ImVec2 ImGui::CalcTextSizeCached(const ImFont* font, float font_size, float max_width, float wrap_width, const char* text, const char* text_end, const char** remaining)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextLayoutCache* cache = &g.TextLayoutCache;
+    if (!text_end)
+        text_end = text + strlen(text);
+    const int text_len = (int)(text_end - text);
+    if (cache->Capacity <= 0 || text_len < cache->MinTextLen)
+        return font->CalcTextSizeA(font_size, max_width, wrap_width, text, text_end, remaining);
+
+    // Lookup
+    // (use ImHashDataFast() as ImHashData() may be CRC32, which costs about as much as measuring short ASCII text)
+    const float params[3] = { font_size, max_width, wrap_width };
+    const ImGuiID key = ImHashDataFast(text, (size_t)text_len, ImHashDataFast(params, sizeof(params), ImHashDataFast(&font, sizeof(font))));
+    if (cache->Buckets.Size > 0)
+    {
+        for (int idx = cache->Buckets[key & (cache->Buckets.Size - 1)]; idx != -1; idx = cache->Entries[idx].HashNext)
+        {
+            ImGuiTextLayoutCacheEntry& entry = cache->Entries[idx];
+            if (entry.Key != key || entry.Font != font || entry.FontSize != font_size || entry.MaxWidth != max_width || entry.WrapWidth != wrap_width || entry.TextLen != text_len)
+                continue;
+            if (memcmp(cache->TextBuf.Data + entry.TextOffset, text, (size_t)text_len) != 0) // Hash collision
+                continue;
+            entry.LastFrameUsed = g.FrameCount;
+            if (cache->LruHead != idx)
+            {
+                TextLayoutCacheUnlink(cache, idx);
+                TextLayoutCacheLinkFront(cache, idx);
+            }
+            cache->Hits++;
+            if (remaining)
+                *remaining = text + entry.RemainingOffset;
+            return entry.Size;
+        }
+    }
+
+    // Measure
+    cache->Misses++;
+    const char* text_remaining = NULL;
+    ImVec2 text_size = font->CalcTextSizeA(font_size, max_width, wrap_width, text, text_end, &text_remaining);
+    if (remaining)
+        *remaining = text_remaining;
+
+    // Insert. When full, only recycle an entry which hasn't been used during this frame.
+    if (cache->Buckets.Size == 0)
+    {
+        int buckets_count = 16;
+        while (buckets_count < cache->Capacity * 2)
+            buckets_count <<= 1;
+        cache->Buckets.resize(buckets_count, -1);
+        cache->Entries.reserve(cache->Capacity);
+    }
+    if (cache->Count >= cache->Capacity)
+    {
+        if (cache->LruTail == -1 || cache->Evictions >= cache->EvictionBudget || cache->Entries[cache->LruTail].LastFrameUsed == g.FrameCount)
+            return text_size;
+        TextLayoutCacheEvict(cache, cache->LruTail);
+    }
+    if (cache->TextBuf.Size + text_len > cache->TextBuf.Capacity && cache->TextBufUnused * 2 >= cache->TextBuf.Size)
+        TextLayoutCacheCompactTextBuf(cache);
+    int idx = cache->FreeIdx;
+    if (idx != -1)
+        cache->FreeIdx = cache->Entries[idx].HashNext;
+    else
+        idx = cache->Entries.Size, cache->Entries.resize(cache->Entries.Size + 1);
+    ImGuiTextLayoutCacheEntry& entry = cache->Entries[idx];
+    entry.Key = key;
+    entry.TextOffset = cache->TextBuf.Size;
+    cache->TextBuf.resize(cache->TextBuf.Size + text_len);
+    memcpy(cache->TextBuf.Data + entry.TextOffset, text, (size_t)text_len);
+    entry.Font = font;
+    entry.FontSize = font_size;
+    entry.MaxWidth = max_width;
+    entry.WrapWidth = wrap_width;
+    entry.TextLen = text_len;
+    entry.RemainingOffset = (int)(text_remaining - text);
+    entry.Size = text_size;
+    entry.LastFrameUsed = g.FrameCount;
+    int* p_bucket = &cache->Buckets[key & (cache->Buckets.Size - 1)];
+    entry.HashNext = *p_bucket;
+    *p_bucket = idx;
+    TextLayoutCacheLinkFront(cache, idx);
+    cache->Count++;
+    return text_size;
+}
+
+void ImGui::ClearTextLayoutCache()
+{
+    ImGuiContext& g = *GImGui;
+    g.TextLayoutCache.Clear();
+    for (int n = 0; n < g.WrappedTextCaches.Size; n++)
+        IM_DELETE(g.WrappedTextCaches[n]);
+    g.WrappedTextCaches.clear();
+}
+
+// Lay out wrapped lines until reaching 'min_lines_count' lines and having processed at least 'budget' bytes, or the end of the text.
+// This mirrors the line breaking of ImFont::CalcTextSizeA()/RenderText(): a wrap position computed by CalcWordWrapPositionA() stays valid across '\n'.
+static void WrappedTextCacheBuild(ImGuiWrappedTextCache* cache, const char* text, const char* text_end, int min_lines_count, int budget)
+{
+    const ImFont* font = cache->Font;
+    const float scale = cache->FontSize / font->FontSize;
+    const char* s = text + cache->BuildOffset;
+    const char* word_wrap_eol = (cache->BuildWrapEolOffset >= 0) ? text + cache->BuildWrapEolOffset : NULL;
+    const char* s_budget_end = (text_end - s > budget) ? s + budget : text_end;
+    if (cache->LineOffsets.Size == 0)
+        cache->LineOffsets.push_back(0);
+    while (s < text_end && (s < s_budget_end || cache->LineOffsets.Size < min_lines_count))
+    {
+        if (!word_wrap_eol)
+        {
+            word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, cache->WrapWidth);
+            if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character, like CalcTextSizeA().
+            {
+                unsigned int c;
+                word_wrap_eol += ImTextCharFromUtf8(&c, s, text_end);
+            }
+        }
+
+        const char* line_begin = text + cache->LineOffsets.back();
+        const char* line_end;
+        if (s < word_wrap_eol)
+        {
+            // Carriage return before the wrap position
+            line_end = (const char*)memchr(s, '\n', (size_t)(word_wrap_eol - s));
+            if (line_end == NULL)
+            {
+                s = word_wrap_eol;
+                if (s < text_end)
+                    continue;
+
+                // Last line (not counted by CalcTextSizeA() if it has no width)
+                const float line_width = font->CalcTextSizeA(cache->FontSize, FLT_MAX, 0.0f, line_begin, text_end).x;
+                cache->Width = ImMax(cache->Width, line_width);
+                if (line_width <= 0.0f && cache->LineOffsets.Size > 1)
+                    cache->LineOffsets.pop_back();
+                break;
+            }
+            s = line_end + 1;
+        }
+        else
+        {
+            // Wrap, skipping upcoming blanks
+            line_end = s;
+            word_wrap_eol = NULL;
+            while (s < text_end)
+            {
+                const char c = *s;
+                if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+            }
+        }
+        cache->Width = ImMax(cache->Width, font->CalcTextSizeA(cache->FontSize, FLT_MAX, 0.0f, line_begin, line_end).x);
+        if (s < text_end)
+            cache->LineOffsets.push_back((int)(s - text));
+    }
+    cache->BuildOffset = (int)(s - text);
+    cache->BuildWrapEolOffset = word_wrap_eol ? (int)(word_wrap_eol - text) : -1;
+}
+
+// Return the wrapped lines of a large text, building them incrementally. Entries are looked up by text pointer, length and layout
+// parameters, then validated with the version given by the caller, or else a hash of the whole contents (never with a partial check:
+// a stale layout would display wrong lines). When the wrap width changes (e.g. resizing a window), the entry of the previous width
+// is rebuilt instead of allocating a new one.
+ImGuiWrappedTextCache* ImGui::GetWrappedTextCache(const char* text, const char* text_end, float wrap_width, int min_lines_count, const ImU32* text_version)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+
+    // Lookup
+    ImGuiWrappedTextCache* cache = NULL;
+    for (int n = 0; n < g.WrappedTextCaches.Size && cache == NULL; n++)
+    {
+        ImGuiWrappedTextCache* c = g.WrappedTextCaches[n];
+        if (c->Text == text && c->TextLen == text_len && c->Font == g.Font && c->FontSize == g.FontSize && c->WrapWidth == wrap_width)
+            cache = c;
+    }
+    for (int n = 0; n < g.WrappedTextCaches.Size && cache == NULL; n++)
+        if (g.WrappedTextCaches[n]->Text == text && g.WrappedTextCaches[n]->LastFrameUsed != g.FrameCount)
+            cache = g.WrappedTextCaches[n];
+    if (cache == NULL)
+    {
+        cache = IM_NEW(ImGuiWrappedTextCache)();
+        g.WrappedTextCaches.push_back(cache);
+    }
+
+    // (Re)initialize
+    const ImU32 text_stamp = text_version ? *text_version : ImHashDataFast(text, (size_t)text_len);
+    const bool text_stamp_is_version = (text_version != NULL);
+    if (cache->Text != text || cache->TextLen != text_len || cache->TextStamp != text_stamp || cache->TextStampIsVersion != text_stamp_is_version || cache->Font != g.Font || cache->FontSize != g.FontSize || cache->WrapWidth != wrap_width || cache->AtlasBuildId != g.TextLayoutCache.AtlasBuildId)
+    {
+        cache->Text = text;
+        cache->TextLen = text_len;
+        cache->TextStamp = text_stamp;
+        cache->TextStampIsVersion = text_stamp_is_version;
+        cache->Font = g.Font;
+        cache->FontSize = g.FontSize;
+        cache->WrapWidth = wrap_width;
+        cache->AtlasBuildId = g.TextLayoutCache.AtlasBuildId;
+        cache->LineOffsets.resize(0);
+        cache->Width = 0.0f;
+        cache->BuildOffset = 0;
+        cache->BuildWrapEolOffset = -1;
+    }
+    cache->LastFrameUsed = g.FrameCount;
+
+    if (!cache->IsBuilt())
+        WrappedTextCacheBuild(cache, text, text_end, min_lines_count, WRAPPED_TEXT_CACHE_BUILD_BUDGET);
+    return cache;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
@@ -4604,6 +5719,12 @@ bool ImGui::BeginChild(const char* str_id, const ImVec2& size_arg, bool border,
     return BeginChildEx(str_id, window->GetID(str_id), size_arg, border, extra_flags);
 }
 
+bool ImGui::BeginChild(const ImGuiHashedLabel& str_id, const ImVec2& size_arg, bool border, ImGuiWindowFlags extra_flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    return BeginChildEx(str_id.Label, window->GetID(str_id), size_arg, border, extra_flags);
+}
+
 bool ImGui::BeginChild(ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWindowFlags extra_flags)
 {
     IM_ASSERT(id != 0);
@@ -5252,6 +6373,44 @@ void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& titl
     }
 }
 
+// Hash everything last frame's geometry was generated from, so Begin() can submit it again as-is (see SetNextWindowContentHash()).
+// Return 0 when the window cannot be reused this frame: anything interacting with it (hovering, focus, active item, popups..) needs items to be submitted.
+// Child windows are excluded as they may render their decorations in their parent's draw list, and windows with child windows are excluded for the same reason.
+ImGuiID ImGui::CalcWindowDrawListReuseHash(ImGuiWindow* window, const char* name, bool has_close_button, const ImU32 resize_grip_col[4])
+{
+    ImGuiContext& g = *GImGui;
+    if (!(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasContentHash))
+        return 0;
+    if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip))
+        return 0;
+    if (window->Appearing || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->DC.ChildWindows.Size > 0)
+        return 0;
+    if (g.HoveredWindow == window || g.HoveredRootWindow == window || g.NavWindow == window || g.MovingWindow == window || (g.ActiveId != 0 && g.ActiveIdWindow == window) || window->ResizeBorderHeld != -1)
+        return 0;
+    if (g.NavWindowingTarget || g.NavWindowingTargetAnim || g.DragDropActive || g.LogEnabled)
+        return 0;
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+        if (g.OpenPopupStack[n].Window == NULL || g.OpenPopupStack[n].Window->ParentWindow == window || g.OpenPopupStack[n].SourceWindow == window)
+            return 0;
+
+    const bool title_bar_is_highlight = g.NavWindow && window->RootWindowForTitleBarHighlight == g.NavWindow->RootWindowForTitleBarHighlight;
+    const ImVec2 vec_values[] = { window->Pos, window->Size, window->Scroll, window->ScrollbarSizes, window->ContentSize, window->ContentSizeExplicit, g.IO.DisplaySize };
+    const ImU32 int_values[] = { (ImU32)window->Flags, (ImU32)window->Collapsed, (ImU32)has_close_button, (ImU32)title_bar_is_highlight, (ImU32)g.IO.ConfigWindowsResizeFromEdges, (ImU32)g.DrawListSharedData.InitialFlags, resize_grip_col[0], resize_grip_col[1], resize_grip_col[2], resize_grip_col[3] };
+    const float float_values[] = { g.FontSize, (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasBgAlpha) ? g.NextWindowData.BgAlphaVal : -1.0f };
+    const ImFont* font = g.Font;
+    const ImTextureID tex_id = g.Font->ContainerAtlas->TexID;
+    if (g.StyleHash == 0)
+        g.StyleHash = ImHashData(&g.Style, sizeof(g.Style), 1);
+    ImGuiID hash = ImHashStr(name, 0, g.NextWindowData.ContentHashVal);
+    hash = ImHashData(&g.StyleHash, sizeof(g.StyleHash), hash);
+    hash = ImHashData(vec_values, sizeof(vec_values), hash);
+    hash = ImHashData(int_values, sizeof(int_values), hash);
+    hash = ImHashData(float_values, sizeof(float_values), hash);
+    hash = ImHashData(&font, sizeof(font), hash);
+    hash = ImHashData(&tex_id, sizeof(tex_id), hash);
+    return (hash != 0) ? hash : 1;
+}
+
 void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags flags, ImGuiWindow* parent_window)
 {
     window->ParentWindow = parent_window;
@@ -5662,9 +6821,20 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->Scroll = CalcNextScrollFromScrollTargetAndClamp(window, true);
         window->ScrollTarget = ImVec2(FLT_MAX, FLT_MAX);
 
+        // Submit last frame's draw list again if nothing it depends on has changed (see SetNextWindowContentHash())
+        // Draw calls issued by Begin()/End() are then redirected to a discarded list and items are skipped.
+        const ImGuiID draw_list_reuse_hash = CalcWindowDrawListReuseHash(window, name, p_open != NULL, resize_grip_col);
+        const bool draw_list_was_reused = window->DrawListReused;
+        window->DrawListReused = (draw_list_reuse_hash != 0 && draw_list_reuse_hash == window->DrawListReuseHash);
+        window->DrawListReuseHash = draw_list_reuse_hash;
+        if (draw_list_was_reused && !window->DrawListReused)
+            window->SkipItems = window->Collapsed; // SkipItems was forced last frame, don't let it affect decorations (e.g. scrollbars)
+
         // DRAWING
 
         // Setup draw list and outer clipping rectangle
+        if (window->DrawListReused)
+            window->DrawList = &window->DrawListDiscard;
         window->DrawList->Clear();
         window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
         PushClipRect(host_rect.Min, host_rect.Max, false);
@@ -5701,7 +6871,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         
         const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
         const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
-        RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
+        if (!window->DrawListReused)
+            RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
 
         if (render_decorations_in_parent)
             window->DrawList = &window->DrawListInst;
@@ -5753,13 +6924,15 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.CursorStartPos = window->Pos + ImVec2(window->DC.Indent.x + window->DC.ColumnsOffset.x, decoration_up_height + window->WindowPadding.y - window->Scroll.y);
         window->DC.CursorPos = window->DC.CursorStartPos;
         window->DC.CursorPosPrevLine = window->DC.CursorPos;
-        window->DC.CursorMaxPos = window->DC.CursorStartPos;
+        if (!window->DrawListReused) // When reusing last frame's draw list, items are not submitted: keep their layout output from last frame
+            window->DC.CursorMaxPos = window->DC.CursorStartPos;
         window->DC.CurrLineSize = window->DC.PrevLineSize = ImVec2(0.0f, 0.0f);
         window->DC.CurrLineTextBaseOffset = window->DC.PrevLineTextBaseOffset = 0.0f;
         window->DC.NavHideHighlightOneFrame = false;
         window->DC.NavHasScroll = (window->ScrollMax.y > 0.0f);
         window->DC.NavLayerActiveMask = window->DC.NavLayerActiveMaskNext;
-        window->DC.NavLayerActiveMaskNext = 0x00;
+        if (!window->DrawListReused)
+            window->DC.NavLayerActiveMaskNext = 0x00;
         window->DC.MenuBarAppending = false;
         window->DC.ChildWindows.resize(0);
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -5776,7 +6949,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TreeStoreMayJumpToParentOnPop = 0x00;
         window->DC.StateStorage = &window->StateStorage;
         window->DC.GroupStack.resize(0);
-        window->MenuColumns.Update(3, style.ItemSpacing.x, window_just_activated_by_user);
+        if (!window->DrawListReused)
+            window->MenuColumns.Update(3, style.ItemSpacing.x, window_just_activated_by_user);
 
         if ((flags & ImGuiWindowFlags_ChildWindow) && (window->DC.ItemFlags != parent_window->DC.ItemFlags))
         {
@@ -5797,7 +6971,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         }
 
         // Title bar
-        if (!(flags & ImGuiWindowFlags_NoTitleBar))
+        if (!(flags & ImGuiWindowFlags_NoTitleBar) && !window->DrawListReused)
             RenderWindowTitleBarContents(window, title_bar_rect, name, p_open);
 
         // Pressing CTRL+C while holding on a window copy its content to the clipboard
@@ -5823,6 +6997,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     {
         // Append
         SetCurrentWindow(window);
+        if (window->DrawListReused)
+            window->DrawList = &window->DrawListDiscard;
     }
 
     PushClipRect(window->InnerClipRect.Min, window->InnerClipRect.Max, true);
@@ -5862,6 +7038,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (window->Collapsed || !window->Active || window->Hidden)
         if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
             skip_items = true;
+    if (window->DrawListReused)
+        skip_items = true;
     window->SkipItems = skip_items;
 
     return !skip_items;
@@ -5899,6 +7077,8 @@ void ImGui::End()
     if (window->DC.CurrentColumns)
         EndColumns();
     PopClipRect();   // Inner window clip rectangle
+    if (window->DrawListReused)
+        window->DrawList = &window->DrawListInst;
 
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
@@ -6027,6 +7207,13 @@ void ImGui::SetNextItemWidth(float item_width)
     g.NextItemData.Width = item_width;
 }
 
+void ImGui::SetNextItemTextVersion(ImU32 version)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextItemData.Flags |= ImGuiNextItemDataFlags_HasTextVersion;
+    g.NextItemData.TextVersion = version;
+}
+
 void ImGui::PushItemWidth(float item_width)
 {
     ImGuiContext& g = *GImGui;
@@ -6196,6 +7383,7 @@ void ImGui::PushStyleColor(ImGuiCol idx, ImU32 col)
     backup.BackupValue = g.Style.Colors[idx];
     g.ColorModifiers.push_back(backup);
     g.Style.Colors[idx] = ColorConvertU32ToFloat4(col);
+    g.StyleHash = 0;
 }
 
 void ImGui::PushStyleColor(ImGuiCol idx, const ImVec4& col)
@@ -6206,6 +7394,7 @@ void ImGui::PushStyleColor(ImGuiCol idx, const ImVec4& col)
     backup.BackupValue = g.Style.Colors[idx];
     g.ColorModifiers.push_back(backup);
     g.Style.Colors[idx] = col;
+    g.StyleHash = 0;
 }
 
 void ImGui::PopStyleColor(int count)
@@ -6218,6 +7407,7 @@ void ImGui::PopStyleColor(int count)
         g.ColorModifiers.pop_back();
         count--;
     }
+    g.StyleHash = 0;
 }
 
 struct ImGuiStyleVarInfo
@@ -6271,6 +7461,7 @@ void ImGui::PushStyleVar(ImGuiStyleVar idx, float val)
         float* pvar = (float*)var_info->GetVarPtr(&g.Style);
         g.StyleModifiers.push_back(ImGuiStyleMod(idx, *pvar));
         *pvar = val;
+        g.StyleHash = 0;
         return;
     }
     IM_ASSERT(0 && "Called PushStyleVar() float variant but variable is not a float!");
@@ -6285,6 +7476,7 @@ void ImGui::PushStyleVar(ImGuiStyleVar idx, const ImVec2& val)
         ImVec2* pvar = (ImVec2*)var_info->GetVarPtr(&g.Style);
         g.StyleModifiers.push_back(ImGuiStyleMod(idx, *pvar));
         *pvar = val;
+        g.StyleHash = 0;
         return;
     }
     IM_ASSERT(0 && "Called PushStyleVar() ImVec2 variant but variable is not a ImVec2!");
@@ -6304,6 +7496,7 @@ void ImGui::PopStyleVar(int count)
         g.StyleModifiers.pop_back();
         count--;
     }
+    g.StyleHash = 0;
 }
 
 const char* ImGui::GetStyleColorName(ImGuiCol idx)
@@ -6667,6 +7860,13 @@ void ImGui::SetNextWindowBgAlpha(float alpha)
     g.NextWindowData.BgAlphaVal = alpha;
 }
 
+void ImGui::SetNextWindowContentHash(ImGuiID hash)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextWindowData.Flags |= ImGuiNextWindowDataFlags_HasContentHash;
+    g.NextWindowData.ContentHashVal = hash;
+}
+
 // FIXME: This is in window space (not screen space!). We should try to obsolete all those functions.
 ImVec2 ImGui::GetContentRegionMax()
 {
@@ -6969,6 +8169,12 @@ void ImGui::PushID(int int_id)
     window->IDStack.push_back(window->GetIDNoKeepAlive(int_id));
 }
 
+void ImGui::PushID(const ImGuiHashedLabel& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    window->IDStack.push_back(window->GetIDNoKeepAlive(str_id));
+}
+
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiID id)
 {
@@ -7000,6 +8206,12 @@ ImGuiID ImGui::GetID(const void* ptr_id)
     return window->GetID(ptr_id);
 }
 
+ImGuiID ImGui::GetID(const ImGuiHashedLabel& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
 bool ImGui::IsRectVisible(const ImVec2& size)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -9956,6 +11168,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     static bool show_windows_rects = false;
     static int  show_windows_rect_type = WRT_WorkRect;
     static bool show_drawcmd_clip_rects = true;
+    static bool show_damage_rects = false;
 
     ImGuiIO& io = ImGui::GetIO();
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
@@ -9997,6 +11210,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             if (!node_open)
                 return;
 
+            if (draw_list->Flags & ImDrawListFlags_CoarseCulling)
+                ImGui::BulletText("Coarse culling: %d primitives emitted, %d culled", draw_list->PrimEmittedCount, draw_list->PrimCulledCount);
             int elem_offset = 0;
             for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.begin(); pcmd < draw_list->CmdBuffer.end(); elem_offset += pcmd->ElemCount, pcmd++)
             {
@@ -10036,9 +11251,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         {
                             int vtx_i = idx_buffer ? idx_buffer[idx_i] : idx_i;
                             ImDrawVert& v = draw_list->VtxBuffer[vtx_i];
-                            triangles_pos[n] = v.pos;
+                            const ImVec2 v_pos = v.pos, v_uv = v.uv;
+                            triangles_pos[n] = v_pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "elem" : "    ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "elem" : "    ", idx_i, v_pos.x, v_pos.y, v_uv.x, v_uv.y, v.col);
                         }
                         ImGui::Selectable(buf, false);
                         if (fg_draw_list && ImGui::IsItemHovered())
@@ -10087,6 +11303,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f)", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y);
             ImGui::BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
             ImGui::BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+            ImGui::BulletText("DrawListReuseHash: 0x%08X, DrawListReused: %d", window->DrawListReuseHash, window->DrawListReused);
             ImGui::BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
             ImGui::BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
             if (!window->NavRectRel[0].IsInverted())
@@ -10173,6 +11390,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::Text("NavDisableHighlight: %d, NavDisableMouseHover: %d", g.NavDisableHighlight, g.NavDisableMouseHover);
         ImGui::Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
         ImGui::Text("DragDrop: %d, SourceId = 0x%08X, Payload \"%s\" (%d bytes)", g.DragDropActive, g.DragDropPayload.SourceId, g.DragDropPayload.DataType, g.DragDropPayload.DataSize);
+        const ImGuiTextLayoutCache& tlc = g.TextLayoutCache;
+        ImGui::Text("TextLayoutCache: %d/%d entries, last frame: %d hits, %d misses, %d evictions", tlc.Count, tlc.Capacity, tlc.HitsLastFrame, tlc.MissesLastFrame, tlc.EvictionsLastFrame);
+        ImGui::Text("WrappedTextCaches: %d", g.WrappedTextCaches.Size);
         ImGui::TreePop();
     }
 
@@ -10195,9 +11415,24 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::Unindent();
         }
         ImGui::Checkbox("Show clipping rectangle when hovering ImDrawCmd node", &show_drawcmd_clip_rects);
+        ImGui::Checkbox("io.ConfigDrawDataDamageRects", &g.IO.ConfigDrawDataDamageRects);
+        ImGui::SameLine();
+        ImGui::Checkbox("Show damage rectangles", &show_damage_rects);
+        ImGui::SameLine();
+        ImGui::Text("(%d last frame)", g.DrawDataBuilder.DamageRects.Size);
         ImGui::TreePop();
     }
 
+    if (show_damage_rects)
+    {
+        ImDrawList* draw_list = GetForegroundDrawList();
+        for (int n = 0; n < g.DrawDataBuilder.DamageRects.Size; n++)
+        {
+            const ImVec4& r = g.DrawDataBuilder.DamageRects[n];
+            draw_list->AddRect(ImVec2(r.x, r.y), ImVec2(r.z, r.w), IM_COL32(255, 255, 0, 255));
+        }
+    }
+
     if (show_windows_rects || show_windows_begin_order)
     {
         for (int n = 0; n < g.Windows.Size; n++)
@@ -19,7 +19,7 @@ Index of this file:
 // ImGuiIO
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
-// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextLog, ImGuiStorage, ImGuiListClipper, ImColor)
 // Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
@@ -75,6 +75,12 @@ Index of this file:
 #define IM_ARRAYSIZE(_ARR)          ((int)(sizeof(_ARR)/sizeof(*_ARR)))         // Size of a static C-style array. Don't use on pointers!
 #define IM_OFFSETOF(_TYPE,_MEMBER)  ((size_t)&(((_TYPE*)0)->_MEMBER))           // Offset of _MEMBER within _TYPE. Standardized as offsetof() in modern C++.
 #define IM_UNUSED(_VAR)             ((void)_VAR)                                // Used to silence "unused variable warnings". Often useful as asserts may be stripped out from final builds.
+#if (__cplusplus >= 201402L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define IM_CONSTEXPR14              constexpr                                   // Functions which can be evaluated at compile-time with C++14 (e.g. ImGuiHashedLabel)
+#define IMGUI_HAS_CONSTEXPR14
+#else
+#define IM_CONSTEXPR14
+#endif
 
 // Warnings
 #if defined(__clang__)
@@ -99,14 +105,17 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawStamp;                 // Fragment of geometry recorded from a draw list, replayed at any position with ImDrawList::AddStamp()
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicData;      // Data kept alive after building an atlas with ImFontAtlasFlags_DynamicGlyphs (opaque structure, defined in imgui_draw.cpp)
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
+struct ImGuiHashedLabel;            // Helper for a string ID with its hash precomputed (at compile-time with C++14), see IM_HASHED_LABEL()
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
@@ -117,6 +126,7 @@ struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbb][,ccccc]")
+struct ImGuiTextLog;                // Helper to hold and display a large text log with a line index (optionally filtered)
 
 // Typedefs and Enums/Flags (declared as int for compatibility with old C++, to allow using as flags and to not pollute the top of this file)
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
@@ -254,6 +264,7 @@ namespace ImGui
     //   Always call a matching EndChild() for each BeginChild() call, regardless of its return value [this is due to legacy reason and is inconsistent with most other functions such as BeginMenu/EndMenu, BeginPopup/EndPopup, etc. where the EndXXX call should only be called if the corresponding BeginXXX function returned true.]
     IMGUI_API bool          BeginChild(const char* str_id, const ImVec2& size = ImVec2(0,0), bool border = false, ImGuiWindowFlags flags = 0);
     IMGUI_API bool          BeginChild(ImGuiID id, const ImVec2& size = ImVec2(0,0), bool border = false, ImGuiWindowFlags flags = 0);
+    IMGUI_API bool          BeginChild(const ImGuiHashedLabel& str_id, const ImVec2& size = ImVec2(0,0), bool border = false, ImGuiWindowFlags flags = 0);
     IMGUI_API void          EndChild();
 
     // Windows Utilities
@@ -276,6 +287,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                 // set next window collapsed state. call before Begin()
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily modify ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowContentHash(ImGuiID hash);                                     // set next window content hash, covering everything your window contents depend on (data, labels..). call before Begin(). when it matches last frame's and the window is idle (not hovered/focused/active), Begin() returns false and last frame's geometry is submitted again. top-level windows only.
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0,0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -373,13 +385,17 @@ namespace ImGui
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(const ImGuiHashedLabel& str_id);                         // push string with precomputed hash into the ID stack (see IM_HASHED_LABEL()). Same ID as PushID(const char*).
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
+    IMGUI_API ImGuiID       GetID(const ImGuiHashedLabel& str_id);                          // same ID as GetID(const char*), without hashing the string at runtime
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL);                // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
+    IMGUI_API void          SetNextItemTextVersion(ImU32 version);                                        // declare a version of the contents of the next large word-wrapped text (> 2000 characters, after PushTextWrapPos()). Change it whenever you modify the text: its cached layout is then validated with it instead of hashing the whole text every frame.
+    IMGUI_API void          TextUnformattedBuffer(const ImGuiTextBuffer* buf);                             // raw text of a ImGuiTextBuffer, with contiguous or chunked storage. Only the chunks around visible lines are processed.
     IMGUI_API void          Text(const char* fmt, ...)                                      IM_FMTARGS(1); // simple formatted text
     IMGUI_API void          TextV(const char* fmt, va_list args)                            IM_FMTLIST(1);
     IMGUI_API void          TextColored(const ImVec4& col, const char* fmt, ...)            IM_FMTARGS(2); // shortcut for PushStyleColor(ImGuiCol_Text, col); Text(fmt, ...); PopStyleColor();
@@ -484,6 +500,7 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(const ImGuiHashedLabel& label);                            // same as TreeNode(const char*), without hashing the label at runtime (see IM_HASHED_LABEL())
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
@@ -693,6 +710,7 @@ namespace ImGui
     // - All those functions are not reliant on the current context.
     // - If you reload the contents of imgui.cpp at runtime, you may need to call SetCurrentContext() + SetAllocatorFunctions() again because we use global storage for those.
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
+    IMGUI_API void          GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
 
@@ -1309,7 +1327,7 @@ struct ImGuiStyle
     float       MouseCursorScale;           // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). May be removed later.
     bool        AntiAliasedLines;           // Enable anti-aliasing on lines/borders. Disable if you are really tight on CPU/GPU.
     bool        AntiAliasedFill;            // Enable anti-aliasing on filled shapes (rounded rectangles, circles, etc.)
-    float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
+    float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo(), AddCircle(), AddCircleFilled() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     ImVec4      Colors[ImGuiCol_COUNT];
 
     IMGUI_API ImGuiStyle();
@@ -1355,6 +1373,7 @@ struct ImGuiIO
     bool        ConfigInputTextCursorBlink;     // = true           // Set to false to disable blinking cursor, for users who consider it distracting. (was called: io.OptCursorBlink prior to 1.63)
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
+    bool        ConfigDrawDataDamageRects;      // = false          // Compare draw lists with the previous frame in Render() to output the regions which changed in ImDrawData::DamageRects[]. Costs hashing all vertices and indices.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1607,25 +1626,101 @@ struct ImGuiTextFilter
 
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
+// Set ChunkSize before appending to store text in a list of separately allocated chunks instead of one contiguous buffer (e.g. for very large logs):
+// appending never copies terminated lines. A line is never split across chunks, so lines are contiguous in memory: an unterminated line which
+// doesn't fit in the last chunk is moved to a new chunk, and a chunk holding a single line is grown in place (reallocated) when it is larger
+// than ChunkSize. begin()/end()/c_str() are not available: use ImGui::TextUnformattedBuffer() to display the text, at() to access a position,
+// or iterate Chunks[]. Positions are stable until clear(), pointers only for terminated lines. Copying a chunked buffer allocates a copy of each chunk.
 struct ImGuiTextBuffer
 {
+    // [Internal]
+    struct ImGuiTextChunk
+    {
+        char*           Data;
+        int             Size;                   // Not zero-terminated
+        int             Capacity;
+        int             Pos;                    // Position of Data[0] in the text
+        int             LinesCount;             // Number of '\n' in Data
+    };
+
     ImVector<char>      Buf;
+    int                 ChunkSize;              // = 0 // Minimum size of a chunk, 0 for contiguous storage. Set before appending (e.g. 1 MB).
+    ImVector<ImGuiTextChunk> Chunks;            // Chunked storage
     static char         EmptyString[1];
 
-    ImGuiTextBuffer()   { }
+    ImGuiTextBuffer()   { ChunkSize = 0; }
+    ImGuiTextBuffer(const ImGuiTextBuffer& src) { ChunkSize = 0; *this = src; }
+    ~ImGuiTextBuffer()  { if (Chunks.Size > 0) clear(); }
+    IMGUI_API ImGuiTextBuffer& operator=(const ImGuiTextBuffer& src);               // Deep copy (chunks are owned by the buffer)
     inline char         operator[](int i)       { IM_ASSERT(Buf.Data != NULL); return Buf.Data[i]; }
-    const char*         begin() const           { return Buf.Data ? &Buf.front() : EmptyString; }
-    const char*         end() const             { return Buf.Data ? &Buf.back() : EmptyString; }   // Buf is zero-terminated, so end() will point on the zero-terminator
-    int                 size() const            { return Buf.Size ? Buf.Size - 1 : 0; }
-    bool                empty()                 { return Buf.Size <= 1; }
-    void                clear()                 { Buf.clear(); }
-    void                reserve(int capacity)   { Buf.reserve(capacity); }
-    const char*         c_str() const           { return Buf.Data ? Buf.Data : EmptyString; }
+    const char*         begin() const           { IM_ASSERT(ChunkSize == 0); return Buf.Data ? &Buf.front() : EmptyString; }
+    const char*         end() const             { IM_ASSERT(ChunkSize == 0); return Buf.Data ? &Buf.back() : EmptyString; }   // Buf is zero-terminated, so end() will point on the zero-terminator
+    int                 size() const            { return (ChunkSize == 0) ? (Buf.Size ? Buf.Size - 1 : 0) : Chunks.Size ? end_pos() - Chunks[0].Pos : 0; }
+    int                 end_pos() const         { return (ChunkSize == 0) ? size() : Chunks.Size ? Chunks.back().Pos + Chunks.back().Size : 0; }  // Position after the last character (== size() unless chunks were released)
+    bool                empty()                 { return size() == 0; }
+    IMGUI_API void      clear();
+    void                reserve(int capacity)   { if (ChunkSize == 0) Buf.reserve(capacity); else Chunks.reserve(capacity / ChunkSize + 1); } // Chunked: reserve the list of chunks (allocated on demand)
+    const char*         c_str() const           { IM_ASSERT(ChunkSize == 0); return Buf.Data ? Buf.Data : EmptyString; }
+    IMGUI_API const char* at(int pos) const;                                                // Pointer to the character at 'pos' (in [0..end_pos()])
     IMGUI_API void      append(const char* str, const char* str_end = NULL);
     IMGUI_API void      appendf(const char* fmt, ...) IM_FMTARGS(2);
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Text log with an index of line offsets, and a cached index of the lines passing a ImGuiTextFilter.
+// Both indices are updated incrementally when appending, so Draw() only processes visible lines with ImGuiListClipper, filtered or not.
+// The filtered index is rebuilt when the filter input changes, testing at most FilterLinesPerFrame lines per call (the results fill over a few frames).
+// Always use Append*() functions to add text, modifying Buf directly would invalidate the indices.
+// - Set MaxSize to bound memory: the oldest lines are removed when the text exceeds it (removed text is discarded in bulk, amortized O(1) per line).
+//   Set Buf.ChunkSize for very large logs: appending never copies previous text, and removed text is released by whole chunks without any copy.
+// - Other threads can add text with Push*(), which are lock-free and never block: text goes to a fixed-size ring buffer (see SetQueueSize()),
+//   and is appended by DrainQueue() on the thread owning the log. Draw() calls DrainQueue(). When the queue is full, pushed text is dropped and counted.
+// - Copying a log copies its text, indices and queue: don't copy it while other threads can push to it.
+// Usage:
+//   static ImGuiTextLog log;
+//   static ImGuiTextFilter filter;
+//   log.Appendf("[%05d] Hello\n", ImGui::GetFrameCount());
+//   filter.Draw();
+//   log.Draw("##log", &filter);
+struct ImGuiTextLog
+{
+    ImGuiTextBuffer     Buf;
+    ImVector<int>       LineOffsets;            // Position of the beginning of each line in Buf, from LineFirst. The last entry is the current (unterminated) line, possibly empty.
+    int                 LineFirst;              // Index of the first line in LineOffsets[] (lines before it were removed because of MaxSize, and are discarded on the next compaction)
+    int                 MaxSize;                // = 0      // Maximum size of the text in bytes, the oldest lines are removed when exceeding it. 0: no limit.
+    ImVector<int>       FilteredLines;          // Index in LineOffsets[] of the lines passing the filter, from FilteredFirst
+    int                 FilteredFirst;          // Index of the first valid entry in FilteredLines[]
+    int                 FilteredLinesScanned;   // Number of terminated lines in LineOffsets[] already tested against the filter
+    char                FilterInputBuf[256];    // Copy of the filter input FilteredLines was built with
+    int                 FilterLinesPerFrame;    // = 100000 // Maximum number of lines tested against the filter per call to UpdateFilteredLines()/Draw(). 0: no limit.
+    bool                AutoScroll;             // = true   // Scroll to the bottom on the next Draw() when lines are appended
+    bool                ScrollToBottom;
+
+    // Multi-producer queue. Queue[] is a ring buffer of records (header + text), positions are in ImU32 units and wrap around.
+    ImVector<ImU32>     Queue;                  // Allocated by SetQueueSize(). Must not be resized while other threads can push.
+    ImU32               QueueWritePos;          // Accessed atomically by producers
+    ImU32               QueueReadPos;           // Written by DrainQueue() only
+    ImU32               QueueDroppedCount;      // Number of Push*() calls which failed because the queue was full
+
+    IMGUI_API           ImGuiTextLog();
+    IMGUI_API void      Clear();                                                        // Clear text (not the queue)
+    IMGUI_API void      Append(const char* str, const char* str_end = NULL);
+    IMGUI_API void      Appendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void      Appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
+    int                 GetLineCount() const            { return (LineOffsets.back() == Buf.end_pos()) ? LineOffsets.Size - LineFirst - 1 : LineOffsets.Size - LineFirst; } // The last line is not counted if empty
+    const char*         GetLineBegin(int line_no) const { return Buf.at(LineOffsets[LineFirst + line_no]); }
+    const char*         GetLineEnd(int line_no) const   { line_no += LineFirst; return Buf.at(LineOffsets[line_no]) + ((line_no + 1 < LineOffsets.Size) ? LineOffsets[line_no + 1] - 1 : Buf.end_pos()) - LineOffsets[line_no]; } // Excluding '\n'
+    IMGUI_API int       UpdateFilteredLines(const ImGuiTextFilter* filter);             // Update FilteredLines and return the number of lines passing the filter (FilteredLines.Size - FilteredFirst, +1 if the current line passes)
+    IMGUI_API void      Draw(const char* str_id, const ImGuiTextFilter* filter = NULL, const ImVec2& size = ImVec2(0, 0)); // Drain queue and display in a child window with ImGuiListClipper
+
+    // Multi-producer queue
+    IMGUI_API void      SetQueueSize(int size_in_bytes);                                // Allocate queue (rounded up to a power of two). Call before any Push*() call.
+    IMGUI_API bool      Push(const char* str, const char* str_end = NULL);              // Thread-safe, lock-free. Return false if the queue is full.
+    IMGUI_API bool      Pushf(const char* fmt, ...) IM_FMTARGS(2);                      // Thread-safe, lock-free. Formatted text is truncated to 1023 characters.
+    IMGUI_API bool      Pushfv(const char* fmt, va_list args) IM_FMTLIST(2);
+    IMGUI_API int       DrainQueue();                                                   // Append queued text. Return number of bytes appended. Call from the thread owning the log.
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -1647,11 +1742,21 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    ImVector<int>                   Index;          // Open-addressing hash table of indices into Data, -1 for empty slots
+    int                             IndexedCount;   // Number of pairs in Index. If != Data.Size (Data was modified directly), Index is rebuilt on the next query
+    ImGuiStorage()                  { IndexedCount = 0; }
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+    // - With IMGUI_USE_HASHED_STORAGE, pairs are stored in insertion order and indexed by a hash table: queries and insertions are O(1).
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); Index.clear(); IndexedCount = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1677,6 +1782,90 @@ struct ImGuiStorage
     IMGUI_API void      BuildSortByKey();
 };
 
+// Helper: String ID with its hash precomputed, for PushID(), GetID(), BeginChild(), TreeNode().
+// With C++14 the hash is computed at compile-time, so literal labels don't need to be hashed every frame:
+//     if (ImGui::TreeNode(IM_HASHED_LABEL("Settings")))    // Same ID and display as ImGui::TreeNode("Settings")
+// - IDs are identical to the ones obtained from the string, including "##" and "###" handling, and whichever hash
+//   function is configured (CRC32, or ImHashDataFast() with IMGUI_USE_FAST_HASH).
+// - Hash doesn't depend on the ID stack: it is combined with the current ID stack seed at runtime, which is cheaper than hashing.
+// - You may also create and store a ImGuiHashedLabel at runtime for a string which doesn't change, it only needs to be hashed once.
+// - IM_HASHED_LABEL() forces compile-time evaluation (C++14). Before C++14 it expands to the string itself, so your code still compiles
+//   and behaves the same, using the regular 'const char*' functions.
+struct ImGuiHashedLabel
+{
+    const char* Label;              // Label to display (may contain "##" or "###")
+    ImU64       Hash;               // Hash of the part of Label used for the ID (all of it, or from the last "###"), independent of the ID stack
+    ImU32       SeedFactor;         // [CRC32] x^(8*IdLength) modulo the CRC32 polynomial, used to combine Hash with the ID stack seed
+    int         IdOffset;           // Part of Label used for the ID
+    int         IdLength;
+
+    IM_CONSTEXPR14 explicit ImGuiHashedLabel(const char* label) : Label(label), Hash(0), SeedFactor(0), IdOffset(0), IdLength(0)
+    {
+        const char* id_begin = label;
+        const char* id_end = label;
+        for (; *id_end; id_end++)
+            if (id_end[0] == '#' && id_end[1] == '#' && id_end[2] == '#')
+                id_begin = id_end;
+        IdOffset = (int)(id_begin - label);
+        IdLength = (int)(id_end - id_begin);
+#ifdef IMGUI_USE_FAST_HASH
+        Hash = HashFast(id_begin, (size_t)(id_end - id_begin));
+#else
+        // Same as ImHashStr() with seed 0 (bitwise version of the CRC32 lookup table)
+        ImU32 crc = 0xFFFFFFFFu;
+        SeedFactor = 0x80000000u;
+        for (const char* p = id_begin; p != id_end; p++)
+        {
+            crc ^= (unsigned char)*p;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+                SeedFactor = (SeedFactor >> 1) ^ (0xEDB88320u & (0u - (SeedFactor & 1u)));
+            }
+        }
+        Hash = ~crc;
+#endif
+    }
+
+    // Implementation of ImHashDataFast(), here so it can be evaluated at compile-time: HashFastCombine(HashFast(data, size), seed)
+    // We read bytes explicitly to get the same result on little and big endian machines. Compilers merge them into a single load.
+    static IM_CONSTEXPR14 ImU64 HashFast(const char* data, size_t data_size)
+    {
+        const ImU64 k = 0x9E3779B97F4A7C15ULL;
+        ImU64 h = (ImU64)data_size * k;
+        size_t i = 0;
+        for (; i + 8 <= data_size; i += 8)
+        {
+            const ImU64 v = (ImU64)(unsigned char)data[i + 0]       | (ImU64)(unsigned char)data[i + 1] << 8  | (ImU64)(unsigned char)data[i + 2] << 16 | (ImU64)(unsigned char)data[i + 3] << 24 |
+                            (ImU64)(unsigned char)data[i + 4] << 32 | (ImU64)(unsigned char)data[i + 5] << 40 | (ImU64)(unsigned char)data[i + 6] << 48 | (ImU64)(unsigned char)data[i + 7] << 56;
+            h = (h ^ v) * k;
+            h ^= h >> 29;
+        }
+        if (i < data_size)
+        {
+            ImU64 v = 0;
+            for (size_t n = 0; i + n < data_size; n++)
+                v |= (ImU64)(unsigned char)data[i + n] << (n * 8);
+            h = (h ^ v) * k;
+            h ^= h >> 29;
+        }
+        return h;
+    }
+    static IM_CONSTEXPR14 ImU32 HashFastCombine(ImU64 h, ImU32 seed)
+    {
+        h ^= (ImU64)seed * 0xC2B2AE3D27D4EB4FULL;
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        return (ImU32)h;
+    }
+};
+#ifdef IMGUI_HAS_CONSTEXPR14
+#define IM_HASHED_LABEL(_LABEL)     ([]() { constexpr ImGuiHashedLabel hashed_label(_LABEL); return hashed_label; }())
+#else
+#define IM_HASHED_LABEL(_LABEL)     _LABEL
+#endif
+
 // Helper: Manually clip large list of items.
 // If you are submitting lots of evenly spaced items and you have a random access to the list, you can perform coarse clipping based on visibility to save yourself from processing those items at all.
 // The clipper calculates the range of visible items and advance the cursor to compensate for the non-visible items we have skipped.
@@ -1793,7 +1982,43 @@ typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT can't be used together!"
+#endif
+// Compact vertex layout (12 bytes instead of 20), enabled with IMGUI_USE_COMPACT_DRAWVERT in imconfig.h.
+// - Positions are stored as signed 16-bit fixed-point numbers with IM_DRAWVERT_POS_FRAC_BITS fractional bits. Default: 2 bits = 1/4 pixel precision, range -8192.0f..+8191.75f.
+// - Texture coordinates are stored as unsigned 16-bit normalized numbers: 0..65535 for 0.0f..1.0f.
+// - Values out of range are clamped: coordinates far outside of the display and UV outside of 0.0f..1.0f (e.g. wrapping textures) are not supported.
+// Assigning or reading an ImVec2 converts from/to floating-point: e.g. 'vtx.pos = ImVec2(x, y)', 'ImVec2 pos = vtx.pos'.
+// Your renderer needs to divide positions by IM_DRAWVERT_POS_SCALE (e.g. in its projection matrix) and to declare texture coordinates as normalized.
+#ifndef IM_DRAWVERT_POS_FRAC_BITS
+#define IM_DRAWVERT_POS_FRAC_BITS   2
+#endif
+#define IM_DRAWVERT_POS_SCALE       ((float)(1 << IM_DRAWVERT_POS_FRAC_BITS))
+struct ImDrawVertPos
+{
+    short           fx, fy;     // Fixed-point
+
+    ImDrawVertPos&  operator=(const ImVec2& v)  { fx = ToFixed(v.x); fy = ToFixed(v.y); return *this; }
+    operator        ImVec2() const              { return ImVec2(fx * (1.0f / IM_DRAWVERT_POS_SCALE), fy * (1.0f / IM_DRAWVERT_POS_SCALE)); }
+    static short    ToFixed(float f)            { f = f * IM_DRAWVERT_POS_SCALE + 32768.5f; f = (f >= 0.0f) ? f : 0.0f; f = (f <= 65535.0f) ? f : 65535.0f; return (short)((int)f - 32768); } // Round to nearest, clamp as float before converting (NaN clamps to the minimum)
+};
+struct ImDrawVertUV
+{
+    unsigned short  nu, nv;     // Normalized
+
+    ImDrawVertUV&   operator=(const ImVec2& v)  { nu = ToNormalized(v.x); nv = ToNormalized(v.y); return *this; }
+    operator        ImVec2() const              { return ImVec2(nu * (1.0f / 65535.0f), nv * (1.0f / 65535.0f)); }
+    static unsigned short ToNormalized(float f) { f = f * 65535.0f + 0.5f; f = (f >= 0.0f) ? f : 0.0f; f = (f <= 65535.0f) ? f : 65535.0f; return (unsigned short)(int)f; }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -1832,6 +2057,31 @@ struct ImDrawListSplitter
     IMGUI_API void              SetCurrentChannel(ImDrawList* draw_list, int channel_idx);
 };
 
+// Fragment of geometry recorded from a draw list, replayed at any position with ImDrawList::AddStamp()/AddStampBatch().
+// Use for small composite shapes drawn many times (icons, node pins, markers): replaying copies and translates vertices
+// and rebases indices, without building paths or tessellating anti-aliased edges again.
+// - Record with RecordBegin()/RecordEnd(): geometry added in-between stays in the draw list and is copied into the stamp,
+//   relative to the given origin. It has to fit in a single draw command (no clip rect or texture change in-between), except
+//   for the commands added when the draw list starts a new VtxOffset (ImGuiBackendFlags_RendererHasVtxOffset with 16-bit indices).
+//   Record where the shape is visible if the draw list uses ImDrawListFlags_CoarseCulling.
+// - Replaying uses the current clip rect, texture and channel of the destination draw list.
+struct ImDrawStamp
+{
+    ImVector<ImDrawVert>        VtxBuffer;      // Vertices, positions relative to the origin passed to RecordEnd()
+    ImVector<ImDrawIdx>         IdxBuffer;      // Indices, relative to VtxBuffer[0]
+    ImVec2                      BoundsMin;      // Bounding box of the positions in VtxBuffer
+    ImVec2                      BoundsMax;
+    int                         _RecordVtxStart;
+    int                         _RecordIdxStart;
+    int                         _RecordCmdCount;
+    unsigned int                _RecordVtxCurrentIdx;
+
+    ImDrawStamp()               { Clear(); }
+    void                        Clear() { VtxBuffer.clear(); IdxBuffer.clear(); BoundsMin = BoundsMax = ImVec2(0.0f, 0.0f); _RecordVtxStart = _RecordIdxStart = _RecordCmdCount = -1; _RecordVtxCurrentIdx = 0; }
+    IMGUI_API void              RecordBegin(const ImDrawList* draw_list);
+    IMGUI_API void              RecordEnd(const ImDrawList* draw_list, const ImVec2& origin);
+};
+
 enum ImDrawCornerFlags_
 {
     ImDrawCornerFlags_TopLeft   = 1 << 0, // 0x1
@@ -1850,7 +2100,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_None             = 0,
     ImDrawListFlags_AntiAliasedLines = 1 << 0,  // Lines are anti-aliased (*2 the number of triangles for 1.0f wide line, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedFill  = 1 << 1,  // Filled shapes have anti-aliased edges (*2 the number of vertices)
-    ImDrawListFlags_AllowVtxOffset   = 1 << 2   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset   = 1 << 2,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_CoarseCulling    = 1 << 3   // Skip primitives whose bounding box is fully outside of the current clipping rectangle, before reserving any vertex. Not set by default: ImGui:: functions already cull at a higher level.
 };
 
 // Draw command list
@@ -1860,7 +2111,8 @@ enum ImDrawListFlags_
 // access the current window draw list and draw custom primitives.
 // You can interleave normal ImGui:: calls and adding primitives to the current draw list.
 // All positions are generally in pixel coordinates (top-left at (0,0), bottom-right at io.DisplaySize), but you are totally free to apply whatever transformation matrix to want to the data (if you apply such transformation you'll want to apply it to ClipRect as well)
-// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects,
+// or set 'Flags |= ImDrawListFlags_CoarseCulling' after the draw list is cleared (e.g. after ImGui::Begin()) to cull each primitive against the current clipping rectangle.
 struct ImDrawList
 {
     // This is what you have to render
@@ -1868,6 +2120,8 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    unsigned int            PrimEmittedCount;   // Number of primitives added since Clear(). Each AddXXX()/PathStroke()/PathFillConvex() call counts for one, each element of a batch too.
+    unsigned int            PrimCulledCount;    // Number of primitives skipped since Clear() because they were fully outside of the clipping rectangle (with ImDrawListFlags_CoarseCulling, and always with batches).
 
     // [Internal, used while building lists]
     const ImDrawListSharedData* _Data;          // Pointer to shared draw data (you can use ImGui::GetDrawListSharedData() to get the one from current ImGui context)
@@ -1884,7 +2138,7 @@ struct ImDrawList
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; Clear(); }
     ~ImDrawList() { ClearFreeMemory(); }
-    IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
+    IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping (unless ImDrawListFlags_CoarseCulling is set). Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
     IMGUI_API void  PushClipRectFullScreen();
     IMGUI_API void  PopClipRect();
     IMGUI_API void  PushTextureID(ImTextureID texture_id);
@@ -1901,8 +2155,8 @@ struct ImDrawList
     IMGUI_API void  AddQuadFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, ImU32 col);
     IMGUI_API void  AddTriangle(const ImVec2& a, const ImVec2& b, const ImVec2& c, ImU32 col, float thickness = 1.0f);
     IMGUI_API void  AddTriangleFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c, ImU32 col);
-    IMGUI_API void  AddCircle(const ImVec2& centre, float radius, ImU32 col, int num_segments = 12, float thickness = 1.0f);
-    IMGUI_API void  AddCircleFilled(const ImVec2& centre, float radius, ImU32 col, int num_segments = 12);
+    IMGUI_API void  AddCircle(const ImVec2& centre, float radius, ImU32 col, int num_segments = 0, float thickness = 1.0f);   // num_segments <= 0: automatic, from radius and style.CurveTessellationTol
+    IMGUI_API void  AddCircleFilled(const ImVec2& centre, float radius, ImU32 col, int num_segments = 0);
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
     IMGUI_API void  AddImage(ImTextureID user_texture_id, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a = ImVec2(0,0), const ImVec2& uv_b = ImVec2(1,1), ImU32 col = IM_COL32_WHITE);
@@ -1912,13 +2166,25 @@ struct ImDrawList
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col); // Note: Anti-aliased filling requires points to be in clockwise order.
     IMGUI_API void  AddBezierCurve(const ImVec2& pos0, const ImVec2& cp0, const ImVec2& cp1, const ImVec2& pos1, ImU32 col, float thickness, int num_segments = 0);
 
+    // Batches: same as calling the function above for each element, reserving memory once for many elements (e.g. scatter plots, heatmaps)
+    // - Elements fully outside of the current clipping rectangle are skipped, even without ImDrawListFlags_CoarseCulling.
+    // - Each element has its own color in cols[count].
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* rects, const ImU32* cols, int count);                                  // rects[count*2]: upper-left, lower-right of each rectangle. No rounding.
+    IMGUI_API void  AddLineBatch(const ImVec2* points, const ImU32* cols, int count, float thickness = 1.0f);                // points[count*2]: both ends of each line
+    IMGUI_API void  AddTriangleFilledBatch(const ImVec2* points, const ImU32* cols, int count);                              // points[count*3]: corners of each triangle
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centres, const float* radii, const ImU32* cols, int count, int num_segments = 0);
+
+    // Stamps: replay geometry recorded in a ImDrawStamp, translated to 'pos' and with colors multiplied by 'tint_col'
+    IMGUI_API void  AddStamp(const ImDrawStamp& stamp, const ImVec2& pos, ImU32 tint_col = IM_COL32_WHITE);                // Culled with ImDrawListFlags_CoarseCulling, like other primitives
+    IMGUI_API void  AddStampBatch(const ImDrawStamp& stamp, const ImVec2* positions, const ImU32* tint_cols, int count);     // Same as calling AddStamp() for each element. tint_cols[count] may be NULL. Always culled, like other batches.
+
     // Stateful path API, add points then finish with PathFillConvex() or PathStroke()
     inline    void  PathClear()                                                 { _Path.Size = 0; }
     inline    void  PathLineTo(const ImVec2& pos)                               { _Path.push_back(pos); }
     inline    void  PathLineToMergeDuplicate(const ImVec2& pos)                 { if (_Path.Size == 0 || memcmp(&_Path.Data[_Path.Size-1], &pos, 8) != 0) _Path.push_back(pos); }
     inline    void  PathFillConvex(ImU32 col)                                   { AddConvexPolyFilled(_Path.Data, _Path.Size, col); _Path.Size = 0; }  // Note: Anti-aliased filling requires points to be in clockwise order.
     inline    void  PathStroke(ImU32 col, bool closed, float thickness = 1.0f)  { AddPolyline(_Path.Data, _Path.Size, col, closed, thickness); _Path.Size = 0; }
-    IMGUI_API void  PathArcTo(const ImVec2& centre, float radius, float a_min, float a_max, int num_segments = 10);
+    IMGUI_API void  PathArcTo(const ImVec2& centre, float radius, float a_min, float a_max, int num_segments = 10);                                 // num_segments <= 0: automatic, same density as AddCircle()
     IMGUI_API void  PathArcToFast(const ImVec2& centre, float radius, int a_min_of_12, int a_max_of_12);                                            // Use precomputed angles for a 12 steps circle
     IMGUI_API void  PathBezierCurveTo(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, int num_segments = 0);
     IMGUI_API void  PathRect(const ImVec2& rect_min, const ImVec2& rect_max, float rounding = 0.0f, int rounding_corners_flags = ImDrawCornerFlags_All);
@@ -1940,6 +2206,7 @@ struct ImDrawList
     IMGUI_API void  Clear();
     IMGUI_API void  ClearFreeMemory();
     IMGUI_API void  PrimReserve(int idx_count, int vtx_count);
+    IMGUI_API void  PrimUnreserve(int idx_count, int vtx_count);                // Release reserved memory which wasn't written to, at the end of the last PrimReserve() call
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
@@ -1963,13 +2230,17 @@ struct ImDrawData
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    ImVec4*         DamageRects;            // Regions (x1, y1, x2, y2), in the same space as ImDrawCmd::ClipRect, where this frame renders differently from the previous one. The whole display when io.ConfigDrawDataDamageRects is not set. A back-end keeping last frame's pixels may restrict rendering/presenting to those, or skip the frame if there are none.
+    int             DamageRectsCount;       // Number of DamageRects[], 0 if nothing changed
 
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); DamageRects = NULL; DamageRectsCount = 0; } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  MergeBuffers(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst, ImVector<ImDrawCmd>* out_cmds = NULL) const;        // Helper to copy all vertices/indices into contiguous buffers of TotalVtxCount/TotalIdxCount elements (e.g. mapped GPU memory) to upload them at once. Output commands have their VtxOffset/IdxOffset rebased: requires a renderer honoring VtxOffset (ImGuiBackendFlags_RendererHasVtxOffset).
+    IMGUI_API void  MergeBuffersIdx32(ImDrawVert* vtx_dst, unsigned int* idx_dst, ImVector<ImDrawCmd>* out_cmds = NULL) const; // Same with 32-bit indices rebased to the start of vtx_dst. Output commands have their IdxOffset rebased and VtxOffset set to 0.
 };
 
 //-----------------------------------------------------------------------------
@@ -2039,11 +2310,19 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// Region of the atlas texture which has been modified after Build() and needs to be uploaded again (see ImFontAtlasFlags_DynamicGlyphs).
+struct ImFontAtlasDirtyRect
+{
+    unsigned short  X, Y;
+    unsigned short  Width, Height;
+};
+
 enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1    // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 2    // Don't rasterize glyphs in Build(): rasterize them on first use by FindGlyph(), into a fixed-size texture. Back-end needs to upload TexDirtyRects[] every frame.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2056,6 +2335,15 @@ enum ImFontAtlasFlags_
 //  - Upload the pixels data into a texture within your graphics system (see imgui_impl_xxxx.cpp examples)
 //  - Call SetTexID(my_tex_id); and pass the pointer/identifier to your texture in a format natural to your graphics API.
 //    This value will be passed back to you during rendering to identify the texture. Read FAQ entry about ImTextureID for more details.
+// Dynamic glyphs (Flags |= ImFontAtlasFlags_DynamicGlyphs):
+//  - Build() only measures glyphs (layout functions such as CalcTextSize() are exact right away), they are rasterized the first time they are rendered.
+//  - The texture has a fixed size (TexDesiredWidth x TexDesiredWidth at most, defaults to 1024) decided in Build(). Glyphs which don't fit are displayed with the fallback glyph.
+//  - Every frame, before rendering, the back-end needs to upload the regions listed in TexDirtyRects[] (from TexPixelsAlpha8 or TexPixelsRGBA32) then clear the list.
+//  - TTF/OTF data and glyph ranges need to persist as long as the atlas is alive. Don't call ClearInputData() or ClearTexData().
+//  - Only supported by the default stb_truetype builder.
+// Multi-threaded build (ParallelForFn != NULL):
+//  - Build() splits glyph measuring and rasterizing into jobs of a few hundred glyphs and calls ParallelForFn() to run them. Packing is still done serially.
+//  - Output is identical to a single-threaded build. Allocator functions set with SetAllocatorFunctions() need to be thread-safe.
 // Common pitfalls:
 // - If you pass a 'glyph_ranges' array to AddFont*** functions, you need to make sure that your array persist up until the
 //   atlas is build (when calling GetTexData*** or Build()). We only copy the pointer, not the data.
@@ -2131,6 +2419,9 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    const char*                 CacheFilename;      // = NULL     // Path to a file where Build() saves its output, to load it instead of rasterizing again when the inputs (font data, configs, glyph ranges) are identical. Ignored with ImFontAtlasFlags_DynamicGlyphs.
+    void                        (*ParallelForFn)(void (*job_fn)(void* job_data, int job_index), void* job_data, int jobs_count, void* user_data); // = NULL // Optional: run job_fn(job_data, n) for every n in [0..jobs_count), from any thread, and return when all calls are done. Used by Build() to measure and rasterize glyphs on multiple threads.
+    void*                       ParallelForUserData;// = NULL     // Passed to ParallelForFn()
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2144,6 +2435,9 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Internal data
     int                         CustomRectIds[1];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
+    ImVector<ImFontAtlasDirtyRect> TexDirtyRects;   // Regions of the texture rasterized since Build() or since the list was last cleared by the back-end (ImFontAtlasFlags_DynamicGlyphs only)
+    ImFontAtlasDynamicData*     DynamicData;        // Rasterizer and packer state kept alive after Build() (ImFontAtlasFlags_DynamicGlyphs only)
+    ImU32                       BuildId;            // Unique in the process, changed by Build() and ClearFonts(). Caches of text measurements are cleared when it changes.
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2155,13 +2449,14 @@ struct ImFontAtlas
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<ImU16>             IndexPages;         // 12-16 // out //            // Index pages, indexed by (codepoint >> 8). IndexAdvanceX[] and IndexLookup[] hold 256 entries per page. Page 0 is shared by all blocks without glyphs.
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
     // Members: Hot ~36/48 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Paged. Index glyphs by Unicode code-point.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
     ImVec2                      DisplayOffset;      // 8     // in  // = (0,0)    // Offset font rendering by xx pixels
@@ -2179,9 +2474,10 @@ struct ImFont
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
-    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
-    IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;             // With ImFontAtlasFlags_DynamicGlyphs, rasterize the returned glyph if needed
+    IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;   // "
+    IMGUI_API bool              HasGlyph(ImWchar c) const;              // Never rasterize, use to test if a font has a glyph
+    float                       GetCharAdvance(ImWchar c) const     { return ((int)c >> 8 < IndexPages.Size) ? IndexAdvanceX.Data[((int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -2196,6 +2492,7 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
     IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              SetGlyphIndex(ImWchar c, ImWchar glyph_index, float advance_x); // Allocate index page of 'c' if needed
     IMGUI_API void              AddGlyph(ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetFallbackChar(ImWchar c);
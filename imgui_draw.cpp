@@ -131,8 +131,10 @@ namespace IMGUI_STB_NAMESPACE
 
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+static void*                ImFontAtlasBuildStbttAlloc(size_t sz, void* user_data);
+static void                 ImFontAtlasBuildStbttFree(void* ptr, void* user_data);
+#define STBTT_malloc(x,u)   ImFontAtlasBuildStbttAlloc(x,u)
+#define STBTT_free(x,u)     ImFontAtlasBuildStbttFree(x,u)
 #define STBTT_assert(x)     IM_ASSERT(x)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -343,11 +345,23 @@ void ImGui::StyleColorsLight(ImGuiStyle* dst)
 // ImDrawList
 //-----------------------------------------------------------------------------
 
+// Resolutions of the unit circle table in ImDrawListSharedData::CircleVtx[]
+static const int IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[IM_DRAWLIST_CIRCLE_VTX_RES_COUNT] = { 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512 };
+
+static void CircleCalcUnitVtx(ImVec2* out_vtx, int num_segments)
+{
+    for (int i = 0; i < num_segments; i++)
+    {
+        const float a = ((float)i * 2 * IM_PI) / (float)num_segments;
+        out_vtx[i] = ImVec2(ImCos(a), ImSin(a));
+    }
+}
+
 ImDrawListSharedData::ImDrawListSharedData()
 {
     Font = NULL;
     FontSize = 0.0f;
-    CurveTessellationTol = 0.0f;
+    CurveTessellationTol = 1.25f;
     ClipRectFullscreen = ImVec4(-8192.0f, -8192.0f, +8192.0f, +8192.0f);
     InitialFlags = ImDrawListFlags_None;
 
@@ -357,6 +371,70 @@ ImDrawListSharedData::ImDrawListSharedData()
         const float a = ((float)i * 2 * IM_PI) / (float)IM_ARRAYSIZE(CircleVtx12);
         CircleVtx12[i] = ImVec2(ImCos(a), ImSin(a));
     }
+    ImVec2* vtx = CircleVtx;
+    for (int res_n = 0; res_n < IM_ARRAYSIZE(IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS); res_n++)
+    {
+        CircleCalcUnitVtx(vtx, IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n]);
+        vtx += IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n];
+    }
+    IM_ASSERT(vtx == CircleVtx + IM_ARRAYSIZE(CircleVtx));
+    CircleSegmentCountsTol = -1.0f;
+    SetCurveTessellationTol(CurveTessellationTol);
+}
+
+// Round up to the nearest resolution of the unit circle table
+static int CircleVtxRoundUpSegmentCount(int num_segments)
+{
+    for (int res_n = 0; res_n < IM_ARRAYSIZE(IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS); res_n++)
+        if (num_segments <= IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n])
+            return IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n];
+    return IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[IM_ARRAYSIZE(IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS) - 1];
+}
+
+// Use segments spanning the angle 'a' for which radius*cos(a) == radius-max_error: their chords are then less than max_error away from the circle
+static int CircleCalcAutoSegmentCount(float radius, float max_error)
+{
+    if (radius != radius) // NaN
+        return IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN;
+    if (max_error <= 0.0f || radius >= FLT_MAX)
+        return IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX;
+    if (radius <= max_error)
+        return IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN;
+    const float num_segments = (IM_PI * 2.0f) / ImAcos((radius - max_error) / radius);
+    const int num_segments_i = (num_segments >= 0.0f && num_segments < (float)IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX) ? (int)num_segments + 1 : IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX;
+    return CircleVtxRoundUpSegmentCount(ImClamp(num_segments_i, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX));
+}
+
+void ImDrawListSharedData::SetCurveTessellationTol(float tol)
+{
+    CurveTessellationTol = tol;
+    if (CircleSegmentCountsTol == tol)
+        return;
+    CircleSegmentCountsTol = tol;
+    for (int i = 0; i < IM_ARRAYSIZE(CircleSegmentCounts); i++)
+        CircleSegmentCounts[i] = (ImU16)CircleCalcAutoSegmentCount((float)i, tol);
+}
+
+// Always return a resolution available in CircleVtx[]
+int ImDrawListSharedData::CalcCircleAutoSegmentCount(float radius) const
+{
+    // Compare as float before converting, as radius may be huge, infinite or NaN
+    radius = ImFabs(radius);
+    if (radius < (float)(IM_ARRAYSIZE(CircleSegmentCounts) - 1) && CircleSegmentCountsTol == CurveTessellationTol)
+        return CircleSegmentCounts[(int)radius + 1]; // Round up so we never use less segments than needed
+    return CircleCalcAutoSegmentCount(radius, CurveTessellationTol);
+}
+
+const ImVec2* ImDrawListSharedData::GetCircleVtx(int num_segments) const
+{
+    const ImVec2* vtx = CircleVtx;
+    for (int res_n = 0; res_n < IM_ARRAYSIZE(IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS) && IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n] <= num_segments; res_n++)
+    {
+        if (IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n] == num_segments)
+            return vtx;
+        vtx += IM_DRAWLIST_CIRCLE_VTX_RESOLUTIONS[res_n];
+    }
+    return NULL;
 }
 
 void ImDrawList::Clear()
@@ -365,6 +443,7 @@ void ImDrawList::Clear()
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
     Flags = _Data ? _Data->InitialFlags : ImDrawListFlags_None;
+    PrimEmittedCount = PrimCulledCount = 0;
     _VtxCurrentOffset = 0;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -539,6 +618,16 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
 
+// Release the last 'idx_count' indices and 'vtx_count' vertices reserved with PrimReserve() but not written.
+void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
+{
+    IM_ASSERT(idx_count >= 0 && vtx_count >= 0);
+    ImDrawCmd& draw_cmd = CmdBuffer.Data[CmdBuffer.Size-1];
+    draw_cmd.ElemCount -= idx_count;
+    VtxBuffer.resize(VtxBuffer.Size - vtx_count);
+    IdxBuffer.resize(IdxBuffer.Size - idx_count);
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -584,224 +673,302 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     _IdxWritePtr += 6;
 }
 
+// Coarse culling of a whole primitive from its bounding box, expanded by 'pad' for thickness and anti-aliasing fringes.
+// Only culls with ImDrawListFlags_CoarseCulling, but always updates the PrimEmittedCount/PrimCulledCount statistics.
+static inline bool PrimCoarseCull(ImDrawList* draw_list, float min_x, float min_y, float max_x, float max_y, float pad)
+{
+    if (draw_list->Flags & ImDrawListFlags_CoarseCulling)
+    {
+        const ImVec4& clip_rect = draw_list->_ClipRectStack.Size ? draw_list->_ClipRectStack.back() : draw_list->_Data->ClipRectFullscreen;
+        if (min_x - pad >= clip_rect.z || min_y - pad >= clip_rect.w || max_x + pad <= clip_rect.x || max_y + pad <= clip_rect.y)
+        {
+            draw_list->PrimCulledCount++;
+            return true;
+        }
+    }
+    draw_list->PrimEmittedCount++;
+    return false;
+}
+
+static bool PrimCoarseCullPoints(ImDrawList* draw_list, const ImVec2* points, int points_count, float pad)
+{
+    if (!(draw_list->Flags & ImDrawListFlags_CoarseCulling) || points_count <= 0)
+    {
+        draw_list->PrimEmittedCount++;
+        return false;
+    }
+    float min_x = points[0].x, min_y = points[0].y, max_x = points[0].x, max_y = points[0].y;
+    for (int i = 1; i < points_count; i++)
+    {
+        min_x = ImMin(min_x, points[i].x); max_x = ImMax(max_x, points[i].x);
+        min_y = ImMin(min_y, points[i].y); max_y = ImMax(max_y, points[i].y);
+    }
+    return PrimCoarseCull(draw_list, min_x, min_y, max_x, max_y, pad);
+}
+
 // On AddPolyline() and AddConvexPolyFilled() we intentionally avoid using ImVec2 and superflous function calls to optimize debug/non-inlined builds.
 // Those macros expects l-values.
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } }
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; }
 
+// Compute the normals of segments [seg_begin, seg_begin+seg_count) of a polyline, segment N going from points[N] to points[N+1] (or points[0] for the last one).
+// Same results as IM_NORMALIZE2F_OVER_ZERO() on each segment, 4 segments at a time when SIMD is available (sqrt and division are exact in both cases).
+static void PolylineComputeNormals(const ImVec2* points, int points_count, int seg_begin, int seg_count, ImVec2* out_normals)
+{
+    int n = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; n + 4 <= seg_count && seg_begin + n + 4 < points_count; n += 4)
+    {
+        const float* p = &points[seg_begin + n].x;
+        const __m128 d01 = _mm_sub_ps(_mm_loadu_ps(p + 2), _mm_loadu_ps(p));         // dx0 dy0 dx1 dy1
+        const __m128 d23 = _mm_sub_ps(_mm_loadu_ps(p + 6), _mm_loadu_ps(p + 4));     // dx2 dy2 dx3 dy3
+        __m128 dx = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 dy = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 mask = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_div_ps(one, _mm_sqrt_ps(d2));
+        dx = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dx, inv_len)), _mm_andnot_ps(mask, dx));
+        dy = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dy, inv_len)), _mm_andnot_ps(mask, dy));
+        const __m128 nx = dy;
+        const __m128 ny = _mm_xor_ps(dx, sign_mask);
+        _mm_storeu_ps(&out_normals[n].x, _mm_unpacklo_ps(nx, ny));
+        _mm_storeu_ps(&out_normals[n + 2].x, _mm_unpackhi_ps(nx, ny));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; n + 4 <= seg_count && seg_begin + n + 4 < points_count; n += 4)
+    {
+        const float32x4x2_t p1 = vld2q_f32(&points[seg_begin + n].x);
+        const float32x4x2_t p2 = vld2q_f32(&points[seg_begin + n + 1].x);
+        float32x4_t dx = vsubq_f32(p2.val[0], p1.val[0]);
+        float32x4_t dy = vsubq_f32(p2.val[1], p1.val[1]);
+        const float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+        const uint32x4_t mask = vcgtq_f32(d2, zero);
+        const float32x4_t inv_len = vdivq_f32(one, vsqrtq_f32(d2));
+        dx = vbslq_f32(mask, vmulq_f32(dx, inv_len), dx);
+        dy = vbslq_f32(mask, vmulq_f32(dy, inv_len), dy);
+        float32x4x2_t normals;
+        normals.val[0] = dy;
+        normals.val[1] = vnegq_f32(dx);
+        vst2q_f32(&out_normals[n].x, normals);
+    }
+#endif
+    for (; n < seg_count; n++)
+    {
+        const int i1 = seg_begin + n;
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[n].x = dy;
+        out_normals[n].y = -dx;
+    }
+}
+
+// Add the triangles between the vertices of two consecutive points of a polyline (see vertex layout in AddPolyline)
+static inline ImDrawIdx* PolylineWriteSegmentIndices(ImDrawIdx* idx_write, unsigned int idx1, unsigned int idx2, int vtx_per_point)
+{
+    if (vtx_per_point == 2)
+    {
+        idx_write[0] = (ImDrawIdx)(idx1+0); idx_write[1] = (ImDrawIdx)(idx2+0); idx_write[2] = (ImDrawIdx)(idx2+1);
+        idx_write[3] = (ImDrawIdx)(idx1+0); idx_write[4] = (ImDrawIdx)(idx2+1); idx_write[5] = (ImDrawIdx)(idx1+1);
+        return idx_write + 6;
+    }
+    if (vtx_per_point == 3)
+    {
+        idx_write[0] = (ImDrawIdx)(idx2+0); idx_write[1] = (ImDrawIdx)(idx1+0); idx_write[2] = (ImDrawIdx)(idx1+2);
+        idx_write[3] = (ImDrawIdx)(idx1+2); idx_write[4] = (ImDrawIdx)(idx2+2); idx_write[5] = (ImDrawIdx)(idx2+0);
+        idx_write[6] = (ImDrawIdx)(idx2+1); idx_write[7] = (ImDrawIdx)(idx1+1); idx_write[8] = (ImDrawIdx)(idx1+0);
+        idx_write[9] = (ImDrawIdx)(idx1+0); idx_write[10]= (ImDrawIdx)(idx2+0); idx_write[11]= (ImDrawIdx)(idx2+1);
+        return idx_write + 12;
+    }
+    idx_write[0]  = (ImDrawIdx)(idx2+1); idx_write[1]  = (ImDrawIdx)(idx1+1); idx_write[2]  = (ImDrawIdx)(idx1+2);
+    idx_write[3]  = (ImDrawIdx)(idx1+2); idx_write[4]  = (ImDrawIdx)(idx2+2); idx_write[5]  = (ImDrawIdx)(idx2+1);
+    idx_write[6]  = (ImDrawIdx)(idx2+1); idx_write[7]  = (ImDrawIdx)(idx1+1); idx_write[8]  = (ImDrawIdx)(idx1+0);
+    idx_write[9]  = (ImDrawIdx)(idx1+0); idx_write[10] = (ImDrawIdx)(idx2+0); idx_write[11] = (ImDrawIdx)(idx2+1);
+    idx_write[12] = (ImDrawIdx)(idx2+2); idx_write[13] = (ImDrawIdx)(idx1+2); idx_write[14] = (ImDrawIdx)(idx1+3);
+    idx_write[15] = (ImDrawIdx)(idx1+3); idx_write[16] = (ImDrawIdx)(idx2+3); idx_write[17] = (ImDrawIdx)(idx2+2);
+    return idx_write + 18;
+}
+
+// Number of indices and vertices written by PolylineWrite()
+static inline void PolylineCalcPrimCount(ImDrawListFlags flags, int points_count, bool closed, float thickness, int* out_idx_count, int* out_vtx_count)
+{
+    const int count = closed ? points_count : points_count-1;
+    const bool thick_line = thickness > 1.0f;
+    if (flags & ImDrawListFlags_AntiAliasedLines)
+    {
+        *out_idx_count = thick_line ? count*18 : count*12;
+        *out_vtx_count = thick_line ? points_count*4 : points_count*3;
+    }
+    else
+    {
+        *out_idx_count = count*6;
+        *out_vtx_count = points_count*2;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
-void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+// Vertices are shared between segments and written in a single pass. Normals are computed in blocks on the stack, so there is no temporary buffer
+// proportional to points_count (which used to be allocated with alloca() and could overflow the stack for very large polylines).
+// Space needs to be reserved beforehand, see PolylineCalcPrimCount().
+static void PolylineWrite(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
 {
-    if (points_count < 2)
-        return;
-
-    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
 
     int count = points_count;
     if (!closed)
         count = points_count-1;
 
     const bool thick_line = thickness > 1.0f;
-    if (Flags & ImDrawListFlags_AntiAliasedLines)
-    {
-        // Anti-aliased stroke
-        const float AA_SIZE = 1.0f;
-        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-
-        const int idx_count = thick_line ? count*18 : count*12;
-        const int vtx_count = thick_line ? points_count*4 : points_count*3;
-        PrimReserve(idx_count, vtx_count);
-
-        // Temporary buffer
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * (thick_line ? 5 : 3) * sizeof(ImVec2)); //-V630
-        ImVec2* temp_points = temp_normals + points_count;
+    const bool anti_aliased = (draw_list->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const float AA_SIZE = 1.0f;
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+
+    // Anti-aliased stroke: 3 vertices per point (center, fringe, fringe), or 4 for thick lines (fringe, edge, edge, fringe)
+    // Non anti-aliased stroke: 2 vertices per point (edge, edge)
+    const int vtx_per_point = anti_aliased ? (thick_line ? 4 : 3) : 2;
+    const int vtx_count = points_count*vtx_per_point;
+
+    // Distances of the vertices to the center line
+    float dist_out, dist_in;
+    if (!anti_aliased)
+        dist_out = dist_in = thickness * 0.5f;
+    else if (thick_line)
+        dist_out = (dist_in = (thickness - AA_SIZE) * 0.5f) + AA_SIZE;
+    else
+        dist_out = dist_in = AA_SIZE;
 
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1+1) == points_count ? 0 : i1+1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
-        if (!closed)
-            temp_normals[points_count-1] = temp_normals[points_count-2];
+    // Normal of the segment ending at the current point. For closed lines the first point is shared with the last segment.
+    float prev_normal_x = 0.0f, prev_normal_y = 0.0f;
+    if (closed)
+    {
+        ImVec2 last_normal;
+        PolylineComputeNormals(points, points_count, count-1, 1, &last_normal);
+        prev_normal_x = last_normal.x;
+        prev_normal_y = last_normal.y;
+    }
 
-        if (!thick_line)
+    const unsigned int idx_base = draw_list->_VtxCurrentIdx;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    ImVec2 normals[64];
+    for (int block_begin = 0; block_begin < points_count; block_begin += IM_ARRAYSIZE(normals))
+    {
+        const int block_end = ImMin(block_begin + IM_ARRAYSIZE(normals), points_count);
+        PolylineComputeNormals(points, points_count, block_begin, ImMin(block_end, count) - block_begin, normals);
+        for (int i = block_begin; i < block_end; i++)
         {
-            if (!closed)
+            // Normal at the point: average of the two segments normals (extruded toward the miter), or the segment normal at the start of an open line.
+            // At the end of an open line, the missing next segment is assumed to continue the last one.
+            const float normal_x = (i < count) ? normals[i - block_begin].x : prev_normal_x;
+            const float normal_y = (i < count) ? normals[i - block_begin].y : prev_normal_y;
+            float dm_x = normal_x, dm_y = normal_y;
+            if (closed || i > 0)
             {
-                temp_points[0] = points[0] + temp_normals[0] * AA_SIZE;
-                temp_points[1] = points[0] - temp_normals[0] * AA_SIZE;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * AA_SIZE;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * AA_SIZE;
+                dm_x = (prev_normal_x + normal_x) * 0.5f;
+                dm_y = (prev_normal_y + normal_y) * 0.5f;
+                IM_FIXNORMAL2F(dm_x, dm_y);
             }
+            prev_normal_x = normal_x;
+            prev_normal_y = normal_y;
 
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
-            for (int i1 = 0; i1 < count; i1++)
+            const ImVec2 p = points[i];
+            const float dm_out_x = dm_x * dist_out, dm_out_y = dm_y * dist_out;
+            const float dm_in_x = dm_x * dist_in, dm_in_y = dm_y * dist_in;
+            if (!anti_aliased)
             {
-                const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+3;
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y)
-                dm_x *= AA_SIZE;
-                dm_y *= AA_SIZE;
-
-                // Add temporary vertexes
-                ImVec2* out_vtx = &temp_points[i2*2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                // Add indexes
-                _IdxWritePtr[0] = (ImDrawIdx)(idx2+0); _IdxWritePtr[1] = (ImDrawIdx)(idx1+0); _IdxWritePtr[2] = (ImDrawIdx)(idx1+2);
-                _IdxWritePtr[3] = (ImDrawIdx)(idx1+2); _IdxWritePtr[4] = (ImDrawIdx)(idx2+2); _IdxWritePtr[5] = (ImDrawIdx)(idx2+0);
-                _IdxWritePtr[6] = (ImDrawIdx)(idx2+1); _IdxWritePtr[7] = (ImDrawIdx)(idx1+1); _IdxWritePtr[8] = (ImDrawIdx)(idx1+0);
-                _IdxWritePtr[9] = (ImDrawIdx)(idx1+0); _IdxWritePtr[10]= (ImDrawIdx)(idx2+0); _IdxWritePtr[11]= (ImDrawIdx)(idx2+1);
-                _IdxWritePtr += 12;
-
-                idx1 = idx2;
+                vtx_write[0].pos = ImVec2(p.x + dm_out_x, p.y + dm_out_y); vtx_write[0].uv = uv; vtx_write[0].col = col;
+                vtx_write[1].pos = ImVec2(p.x - dm_out_x, p.y - dm_out_y); vtx_write[1].uv = uv; vtx_write[1].col = col;
             }
-
-            // Add vertexes
-            for (int i = 0; i < points_count; i++)
+            else if (!thick_line)
             {
-                _VtxWritePtr[0].pos = points[i];          _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-                _VtxWritePtr[1].pos = temp_points[i*2+0]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
-                _VtxWritePtr[2].pos = temp_points[i*2+1]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col_trans;
-                _VtxWritePtr += 3;
+                vtx_write[0].pos = p;                                                vtx_write[0].uv = uv; vtx_write[0].col = col;
+                vtx_write[1].pos = ImVec2(p.x + dm_out_x, p.y + dm_out_y); vtx_write[1].uv = uv; vtx_write[1].col = col_trans;
+                vtx_write[2].pos = ImVec2(p.x - dm_out_x, p.y - dm_out_y); vtx_write[2].uv = uv; vtx_write[2].col = col_trans;
             }
-        }
-        else
-        {
-            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
-            if (!closed)
+            else
             {
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[(points_count-1)*4+0] = points[points_count-1] + temp_normals[points_count-1] * (half_inner_thickness + AA_SIZE);
-                temp_points[(points_count-1)*4+1] = points[points_count-1] + temp_normals[points_count-1] * (half_inner_thickness);
-                temp_points[(points_count-1)*4+2] = points[points_count-1] - temp_normals[points_count-1] * (half_inner_thickness);
-                temp_points[(points_count-1)*4+3] = points[points_count-1] - temp_normals[points_count-1] * (half_inner_thickness + AA_SIZE);
+                vtx_write[0].pos = ImVec2(p.x + dm_out_x, p.y + dm_out_y); vtx_write[0].uv = uv; vtx_write[0].col = col_trans;
+                vtx_write[1].pos = ImVec2(p.x + dm_in_x, p.y + dm_in_y);  vtx_write[1].uv = uv; vtx_write[1].col = col;
+                vtx_write[2].pos = ImVec2(p.x - dm_in_x, p.y - dm_in_y);  vtx_write[2].uv = uv; vtx_write[2].col = col;
+                vtx_write[3].pos = ImVec2(p.x - dm_out_x, p.y - dm_out_y); vtx_write[3].uv = uv; vtx_write[3].col = col_trans;
             }
+            vtx_write += vtx_per_point;
 
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
-            for (int i1 = 0; i1 < count; i1++)
-            {
-                const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+4;
+            // Add indexes for the segment ending at this point, and for the closing segment
+            if (i > 0)
+                idx_write = PolylineWriteSegmentIndices(idx_write, idx_base + (i - 1) * vtx_per_point, idx_base + i * vtx_per_point, vtx_per_point);
+        }
+    }
+    if (closed)
+        idx_write = PolylineWriteSegmentIndices(idx_write, idx_base + (points_count - 1) * vtx_per_point, idx_base, vtx_per_point);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx += vtx_count;
+}
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertexes
-                ImVec2* out_vtx = &temp_points[i2*4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1+2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1+2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2+2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2+1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1+0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1+0); _IdxWritePtr[10] = (ImDrawIdx)(idx2+0); _IdxWritePtr[11] = (ImDrawIdx)(idx2+1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2+2); _IdxWritePtr[13] = (ImDrawIdx)(idx1+2); _IdxWritePtr[14] = (ImDrawIdx)(idx1+3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1+3); _IdxWritePtr[16] = (ImDrawIdx)(idx2+3); _IdxWritePtr[17] = (ImDrawIdx)(idx2+2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
-            }
+static void PolylineAdd(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+{
+    if (points_count < 2)
+        return;
 
-            // Add vertexes
-            for (int i = 0; i < points_count; i++)
-            {
-                _VtxWritePtr[0].pos = temp_points[i*4+0]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i*4+1]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i*4+2]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i*4+3]; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
-            }
-        }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    int idx_count, vtx_count;
+    PolylineCalcPrimCount(draw_list->Flags, points_count, closed, thickness, &idx_count, &vtx_count);
+    draw_list->PrimReserve(idx_count, vtx_count);
+    PolylineWrite(draw_list, points, points_count, col, closed, thickness);
+}
+
+void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+{
+    if (points_count < 2 || PrimCoarseCullPoints(this, points, points_count, thickness * 0.5f + 1.0f))
+        return;
+    PolylineAdd(this, points, points_count, col, closed, thickness);
+}
+
+// Number of indices and vertices written by ConvexPolyFilledWrite()
+static inline void ConvexPolyFilledCalcPrimCount(ImDrawListFlags flags, int points_count, int* out_idx_count, int* out_vtx_count)
+{
+    if (flags & ImDrawListFlags_AntiAliasedFill)
+    {
+        *out_idx_count = (points_count-2)*3 + points_count*6;
+        *out_vtx_count = (points_count*2);
     }
     else
     {
-        // Non Anti-aliased Stroke
-        const int idx_count = count*6;
-        const int vtx_count = count*4;      // FIXME-OPT: Not sharing edges
-        PrimReserve(idx_count, vtx_count);
-
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1+1) == points_count ? 0 : i1+1;
-            const ImVec2& p1 = points[i1];
-            const ImVec2& p2 = points[i2];
-
-            float dx = p2.x - p1.x;
-            float dy = p2.y - p1.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            dx *= (thickness * 0.5f);
-            dy *= (thickness * 0.5f);
-
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
-            _VtxWritePtr += 4;
-
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx+1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx+2);
-            _IdxWritePtr[3] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[4] = (ImDrawIdx)(_VtxCurrentIdx+2); _IdxWritePtr[5] = (ImDrawIdx)(_VtxCurrentIdx+3);
-            _IdxWritePtr += 6;
-            _VtxCurrentIdx += 4;
-        }
+        *out_idx_count = (points_count-2)*3;
+        *out_vtx_count = points_count;
     }
 }
 
 // We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
-void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+// Space needs to be reserved beforehand, see ConvexPolyFilledCalcPrimCount().
+static void ConvexPolyFilledWrite(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col)
 {
-    if (points_count < 3)
-        return;
-
-    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    const unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
 
-    if (Flags & ImDrawListFlags_AntiAliasedFill)
+    if (draw_list->Flags & ImDrawListFlags_AntiAliasedFill)
     {
         // Anti-aliased Fill
         const float AA_SIZE = 1.0f;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count-2)*3 + points_count*6;
         const int vtx_count = (points_count*2);
-        PrimReserve(idx_count, vtx_count);
 
         // Add indexes for fill
-        unsigned int vtx_inner_idx = _VtxCurrentIdx;
-        unsigned int vtx_outer_idx = _VtxCurrentIdx+1;
+        unsigned int vtx_inner_idx = vtx_current_idx;
+        unsigned int vtx_outer_idx = vtx_current_idx+1;
         for (int i = 2; i < points_count; i++)
         {
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx+((i-1)<<1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx+(i<<1));
-            _IdxWritePtr += 3;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx+((i-1)<<1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx+(i<<1));
+            idx_write += 3;
         }
 
         // Compute normals
@@ -829,35 +996,66 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
+            vtx_write[0].pos = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); vtx_write[0].uv = uv; vtx_write[0].col = col;        // Inner
+            vtx_write[1].pos = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); vtx_write[1].uv = uv; vtx_write[1].col = col_trans;  // Outer
+            vtx_write += 2;
 
             // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx+(i1<<1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx+(i0<<1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx+(i0<<1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx+(i0<<1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx+(i1<<1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx+(i1<<1));
-            _IdxWritePtr += 6;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx+(i1<<1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx+(i0<<1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx+(i0<<1));
+            idx_write[3] = (ImDrawIdx)(vtx_outer_idx+(i0<<1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx+(i1<<1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx+(i1<<1));
+            idx_write += 6;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        draw_list->_VtxCurrentIdx += vtx_count;
     }
     else
     {
         // Non Anti-aliased Fill
-        const int idx_count = (points_count-2)*3;
         const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr++;
+            vtx_write[0].pos = points[i]; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write++;
         }
         for (int i = 2; i < points_count; i++)
         {
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx+i-1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx+i);
-            _IdxWritePtr += 3;
+            idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+i-1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+i);
+            idx_write += 3;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        draw_list->_VtxCurrentIdx += vtx_count;
     }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+}
+
+static void ConvexPolyFilledAdd(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3)
+        return;
+
+    int idx_count, vtx_count;
+    ConvexPolyFilledCalcPrimCount(draw_list->Flags, points_count, &idx_count, &vtx_count);
+    draw_list->PrimReserve(idx_count, vtx_count);
+    ConvexPolyFilledWrite(draw_list, points, points_count, col);
+}
+
+void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3 || PrimCoarseCullPoints(this, points, points_count, 1.0f))
+        return;
+    ConvexPolyFilledAdd(this, points, points_count, col);
+}
+
+// Same as PathStroke()/PathFillConvex() for shapes which already went through PrimCoarseCull()
+static inline void PathStrokeNoCull(ImDrawList* draw_list, ImU32 col, bool closed, float thickness)
+{
+    PolylineAdd(draw_list, draw_list->_Path.Data, draw_list->_Path.Size, col, closed, thickness);
+    draw_list->_Path.Size = 0;
+}
+
+static inline void PathFillConvexNoCull(ImDrawList* draw_list, ImU32 col)
+{
+    ConvexPolyFilledAdd(draw_list, draw_list->_Path.Data, draw_list->_Path.Size, col);
+    draw_list->_Path.Size = 0;
 }
 
 void ImDrawList::PathArcToFast(const ImVec2& centre, float radius, int a_min_of_12, int a_max_of_12)
@@ -883,13 +1081,57 @@ void ImDrawList::PathArcTo(const ImVec2& centre, float radius, float a_min, floa
         return;
     }
 
+    // Automatic segment count: same density as a full circle of the same radius
+    if (num_segments <= 0)
+    {
+        const float arc_ratio = ImFabs(a_max - a_min) / (IM_PI * 2.0f);
+        const float num_segments_f = (float)_Data->CalcCircleAutoSegmentCount(radius) * arc_ratio + 0.999f; // Clamp as float before converting: angles may be huge or NaN
+        num_segments = (num_segments_f >= 1.0f) ? (int)ImMin(num_segments_f, (float)IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX) : 1;
+    }
+
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
+    // Intermediate points are obtained by rotating the previous one, so we only call ImCos()/ImSin() for the first step and the end points.
     _Path.reserve(_Path.Size + (num_segments + 1));
-    for (int i = 0; i <= num_segments; i++)
+    const float a_step = (a_max - a_min) / (float)num_segments;
+    const float step_cos = ImCos(a_step);
+    const float step_sin = ImSin(a_step);
+    float dx = ImCos(a_min) * radius;
+    float dy = ImSin(a_min) * radius;
+    _Path.push_back(ImVec2(centre.x + dx, centre.y + dy));
+    for (int i = 1; i < num_segments; i++)
+    {
+        const float next_dx = dx * step_cos - dy * step_sin;
+        dy = dx * step_sin + dy * step_cos;
+        dx = next_dx;
+        _Path.push_back(ImVec2(centre.x + dx, centre.y + dy));
+    }
+    _Path.push_back(ImVec2(centre.x + ImCos(a_max) * radius, centre.y + ImSin(a_max) * radius));
+}
+
+// Closed circle without the overlapping point, using the unit circle table when there is one at this resolution.
+static void PathCircle(ImDrawList* draw_list, const ImVec2& centre, float radius, int num_segments)
+{
+    if (radius == 0.0f)
+    {
+        draw_list->_Path.push_back(centre);
+        return;
+    }
+    ImVector<ImVec2>& path = draw_list->_Path;
+    path.resize(path.Size + num_segments);
+    ImVec2* out = path.Data + path.Size - num_segments;
+    if (const ImVec2* unit_circle = draw_list->_Data->GetCircleVtx(num_segments))
+    {
+        for (int i = 0; i < num_segments; i++)
+            out[i] = ImVec2(centre.x + unit_circle[i].x * radius, centre.y + unit_circle[i].y * radius);
+    }
+    else
     {
-        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-        _Path.push_back(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius));
+        for (int i = 0; i < num_segments; i++)
+        {
+            const float a = ((float)i * 2 * IM_PI) / (float)num_segments;
+            out[i] = ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius);
+        }
     }
 }
 
@@ -972,9 +1214,11 @@ void ImDrawList::AddLine(const ImVec2& a, const ImVec2& b, ImU32 col, float thic
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (PrimCoarseCull(this, ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.x, b.x), ImMax(a.y, b.y), thickness * 0.5f + 1.5f))
+        return;
     PathLineTo(a + ImVec2(0.5f,0.5f));
     PathLineTo(b + ImVec2(0.5f,0.5f));
-    PathStroke(col, false, thickness);
+    PathStrokeNoCull(this, col, false, thickness);
 }
 
 // a: upper-left, b: lower-right. we don't render 1 px sized rectangles properly.
@@ -982,21 +1226,25 @@ void ImDrawList::AddRect(const ImVec2& a, const ImVec2& b, ImU32 col, float roun
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (PrimCoarseCull(this, ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.x, b.x), ImMax(a.y, b.y), thickness * 0.5f + 1.0f))
+        return;
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(a + ImVec2(0.5f,0.5f), b - ImVec2(0.50f,0.50f), rounding, rounding_corners_flags);
     else
         PathRect(a + ImVec2(0.5f,0.5f), b - ImVec2(0.49f,0.49f), rounding, rounding_corners_flags); // Better looking lower-right corner and rounded non-AA shapes.
-    PathStroke(col, true, thickness);
+    PathStrokeNoCull(this, col, true, thickness);
 }
 
 void ImDrawList::AddRectFilled(const ImVec2& a, const ImVec2& b, ImU32 col, float rounding, int rounding_corners_flags)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (PrimCoarseCull(this, ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.x, b.x), ImMax(a.y, b.y), 1.0f))
+        return;
     if (rounding > 0.0f)
     {
         PathRect(a, b, rounding, rounding_corners_flags);
-        PathFillConvex(col);
+        PathFillConvexNoCull(this, col);
     }
     else
     {
@@ -1009,6 +1257,8 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& a, const ImVec2& c, ImU32
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (PrimCoarseCull(this, ImMin(a.x, c.x), ImMin(a.y, c.y), ImMax(a.x, c.x), ImMax(a.y, c.y), 0.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1029,7 +1279,10 @@ void ImDrawList::AddQuad(const ImVec2& a, const ImVec2& b, const ImVec2& c, cons
     PathLineTo(b);
     PathLineTo(c);
     PathLineTo(d);
-    PathStroke(col, true, thickness);
+    if (PrimCoarseCullPoints(this, _Path.Data + _Path.Size - 4, 4, thickness * 0.5f + 1.0f))
+        PathClear();
+    else
+        PathStrokeNoCull(this, col, true, thickness);
 }
 
 void ImDrawList::AddQuadFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, ImU32 col)
@@ -1041,7 +1294,10 @@ void ImDrawList::AddQuadFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c
     PathLineTo(b);
     PathLineTo(c);
     PathLineTo(d);
-    PathFillConvex(col);
+    if (PrimCoarseCullPoints(this, _Path.Data + _Path.Size - 4, 4, 1.0f))
+        PathClear();
+    else
+        PathFillConvexNoCull(this, col);
 }
 
 void ImDrawList::AddTriangle(const ImVec2& a, const ImVec2& b, const ImVec2& c, ImU32 col, float thickness)
@@ -1052,7 +1308,10 @@ void ImDrawList::AddTriangle(const ImVec2& a, const ImVec2& b, const ImVec2& c,
     PathLineTo(a);
     PathLineTo(b);
     PathLineTo(c);
-    PathStroke(col, true, thickness);
+    if (PrimCoarseCullPoints(this, _Path.Data + _Path.Size - 3, 3, thickness * 0.5f + 1.0f))
+        PathClear();
+    else
+        PathStrokeNoCull(this, col, true, thickness);
 }
 
 void ImDrawList::AddTriangleFilled(const ImVec2& a, const ImVec2& b, const ImVec2& c, ImU32 col)
@@ -1063,29 +1322,42 @@ void ImDrawList::AddTriangleFilled(const ImVec2& a, const ImVec2& b, const ImVec
     PathLineTo(a);
     PathLineTo(b);
     PathLineTo(c);
-    PathFillConvex(col);
+    if (PrimCoarseCullPoints(this, _Path.Data + _Path.Size - 3, 3, 1.0f))
+        PathClear();
+    else
+        PathFillConvexNoCull(this, col);
 }
 
 void ImDrawList::AddCircle(const ImVec2& centre, float radius, ImU32 col, int num_segments, float thickness)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    if (num_segments <= 0)
+        num_segments = _Data->CalcCircleAutoSegmentCount(radius);
+    else if (num_segments <= 2)
+        return;
+    const float r = ImFabs(radius) + 0.5f; // Stroked at radius-0.5f, which may be negative
+    if (PrimCoarseCull(this, centre.x - r, centre.y - r, centre.x + r, centre.y + r, thickness * 0.5f + 1.0f))
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = IM_PI*2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(centre, radius-0.5f, 0.0f, a_max, num_segments - 1);
-    PathStroke(col, true, thickness);
+    PathCircle(this, centre, radius-0.5f, num_segments);
+    PathStrokeNoCull(this, col, true, thickness);
 }
 
 void ImDrawList::AddCircleFilled(const ImVec2& centre, float radius, ImU32 col, int num_segments)
 {
-    if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    if (num_segments <= 0)
+        num_segments = _Data->CalcCircleAutoSegmentCount(radius);
+    else if (num_segments <= 2)
+        return;
+    const float r = ImFabs(radius);
+    if (PrimCoarseCull(this, centre.x - r, centre.y - r, centre.x + r, centre.y + r, 1.0f))
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = IM_PI*2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(centre, radius, 0.0f, a_max, num_segments - 1);
-    PathFillConvex(col);
+    PathCircle(this, centre, radius, num_segments);
+    PathFillConvexNoCull(this, col);
 }
 
 void ImDrawList::AddBezierCurve(const ImVec2& pos0, const ImVec2& cp0, const ImVec2& cp1, const ImVec2& pos1, ImU32 col, float thickness, int num_segments)
@@ -1093,9 +1365,260 @@ void ImDrawList::AddBezierCurve(const ImVec2& pos0, const ImVec2& cp0, const ImV
     if ((col & IM_COL32_A_MASK) == 0)
         return;
 
+    // The curve is contained in the convex hull of its control points
+    const float min_x = ImMin(ImMin(pos0.x, cp0.x), ImMin(cp1.x, pos1.x)), max_x = ImMax(ImMax(pos0.x, cp0.x), ImMax(cp1.x, pos1.x));
+    const float min_y = ImMin(ImMin(pos0.y, cp0.y), ImMin(cp1.y, pos1.y)), max_y = ImMax(ImMax(pos0.y, cp0.y), ImMax(cp1.y, pos1.y));
+    if (PrimCoarseCull(this, min_x, min_y, max_x, max_y, thickness * 0.5f + 1.0f))
+        return;
+
     PathLineTo(pos0);
     PathBezierCurveTo(cp0, cp1, pos1, num_segments);
-    PathStroke(col, false, thickness);
+    PathStrokeNoCull(this, col, false, thickness);
+}
+
+//-----------------------------------------------------------------------------
+// Batches: same output as calling the corresponding AddXXX() function for each element, minus the culled ones.
+// - Space is reserved once per chunk of elements, so a chunk doesn't cross the 64K vertices boundary of 16-bit indices.
+// - Elements fully outside of the current clipping rectangle (_ClipRectStack.back()) and fully transparent ones are skipped.
+//-----------------------------------------------------------------------------
+
+static const int IM_DRAWLIST_BATCH_CHUNK_VTX_COUNT = 4096;
+
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+IM_STATIC_ASSERT(sizeof(ImDrawVert) == 20 && IM_OFFSETOF(ImDrawVert, pos) == 0 && IM_OFFSETOF(ImDrawVert, uv) == 8 && IM_OFFSETOF(ImDrawVert, col) == 16);
+#endif
+
+static inline int BatchCalcChunkSize(int vtx_count_per_element)
+{
+    return ImMax(1, IM_DRAWLIST_BATCH_CHUNK_VTX_COUNT / vtx_count_per_element);
+}
+
+static inline bool BatchIsCulled(const ImVec4& clip_rect, float min_x, float min_y, float max_x, float max_y)
+{
+    return min_x >= clip_rect.z || min_y >= clip_rect.w || max_x <= clip_rect.x || max_y <= clip_rect.y;
+}
+
+// rects[] contains count*2 points: min and max of each rectangle
+void ImDrawList::AddRectFilledBatch(const ImVec2* rects, const ImU32* cols, int count)
+{
+    const ImVec4 clip_rect = _ClipRectStack.Size ? _ClipRectStack.back() : _Data->ClipRectFullscreen;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const int chunk_size = BatchCalcChunkSize(4);
+    for (int chunk_begin = 0; chunk_begin < count; chunk_begin += chunk_size)
+    {
+        const int chunk_end = ImMin(chunk_begin + chunk_size, count);
+        PrimReserve((chunk_end - chunk_begin) * 6, (chunk_end - chunk_begin) * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+        // Default ImDrawVert layout: 4 vertices == 80 bytes == 5 stores of { pos.x, pos.y, uv.x, uv.y, col } in sequence
+        const __m128 clip_max_min = _mm_setr_ps(clip_rect.z, clip_rect.w, clip_rect.x, clip_rect.y);
+        const __m128i uv_bits = _mm_castps_si128(_mm_setr_ps(uv.x, uv.y, 0.0f, 0.0f));
+        for (int n = chunk_begin; n < chunk_end; n++)
+        {
+            const __m128 r = _mm_loadu_ps(&rects[n * 2].x);                                        // min.x min.y max.x max.y
+            const int visible_mask = (_mm_movemask_ps(_mm_cmplt_ps(r, clip_max_min)) & 0x03) | (_mm_movemask_ps(_mm_cmpgt_ps(r, clip_max_min)) & 0x0C);
+            if ((cols[n] & IM_COL32_A_MASK) == 0)
+                continue;
+            if (visible_mask != 0x0F)
+            {
+                PrimCulledCount++;
+                continue;
+            }
+            const __m128 uvc = _mm_castsi128_ps(_mm_or_si128(uv_bits, _mm_slli_si128(_mm_cvtsi32_si128((int)cols[n]), 8)));   // uv.x uv.y col 0
+            const __m128 t = _mm_shuffle_ps(uvc, r, _MM_SHUFFLE(1, 2, 0, 2));                     // col uv.x max.x min.y
+            float* dst = &vtx_write[0].pos.x;
+            _mm_storeu_ps(dst + 0, _mm_movelh_ps(r, uvc));                                          // [0] min.x min.y uv.x uv.y
+            _mm_storeu_ps(dst + 4, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 3, 2, 0)));                  // [0] col, [1] max.x min.y uv.x
+            _mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(uvc, uvc, _MM_SHUFFLE(2, 2, 2, 1)), r, _MM_SHUFFLE(3, 2, 1, 0)));   // [1] uv.y col, [2] max.x max.y
+            _mm_storeu_ps(dst + 12, _mm_shuffle_ps(uvc, _mm_shuffle_ps(uvc, r, _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0)));  // [2] uv.x uv.y col, [3] min.x
+            _mm_storeu_ps(dst + 16, _mm_shuffle_ps(_mm_shuffle_ps(r, uvc, _MM_SHUFFLE(0, 0, 3, 3)), uvc, _MM_SHUFFLE(2, 1, 2, 0)));  // [3] max.y uv.x uv.y col
+            vtx_write += 4;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx+1); idx_write[2] = (ImDrawIdx)(idx+2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx+2); idx_write[5] = (ImDrawIdx)(idx+3);
+            idx_write += 6;
+            idx += 4;
+        }
+#else
+        for (int n = chunk_begin; n < chunk_end; n++)
+        {
+            const ImVec2& a = rects[n * 2];
+            const ImVec2& c = rects[n * 2 + 1];
+            const ImU32 col = cols[n];
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            if (BatchIsCulled(clip_rect, a.x, a.y, c.x, c.y))
+            {
+                PrimCulledCount++;
+                continue;
+            }
+            vtx_write[0].pos = a;               vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write[1].pos = ImVec2(c.x, a.y); vtx_write[1].uv = uv; vtx_write[1].col = col;
+            vtx_write[2].pos = c;               vtx_write[2].uv = uv; vtx_write[2].col = col;
+            vtx_write[3].pos = ImVec2(a.x, c.y); vtx_write[3].uv = uv; vtx_write[3].col = col;
+            vtx_write += 4;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx+1); idx_write[2] = (ImDrawIdx)(idx+2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx+2); idx_write[5] = (ImDrawIdx)(idx+3);
+            idx_write += 6;
+            idx += 4;
+        }
+#endif
+        const int written_count = (int)(vtx_write - _VtxWritePtr) / 4;
+        PrimEmittedCount += written_count;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve((chunk_end - chunk_begin - written_count) * 6, (chunk_end - chunk_begin - written_count) * 4);
+    }
+}
+
+// points[] contains count*2 points: both ends of each line
+void ImDrawList::AddLineBatch(const ImVec2* points, const ImU32* cols, int count, float thickness)
+{
+    const ImVec4 clip_rect = _ClipRectStack.Size ? _ClipRectStack.back() : _Data->ClipRectFullscreen;
+    const float extent = thickness * 0.5f + 1.5f; // Half thickness + AA fringe + 0.5f offset (see AddLine())
+    int idx_count, vtx_count;
+    PolylineCalcPrimCount(Flags, 2, false, thickness, &idx_count, &vtx_count);
+    const int chunk_size = BatchCalcChunkSize(vtx_count);
+    for (int chunk_begin = 0; chunk_begin < count; chunk_begin += chunk_size)
+    {
+        const int chunk_end = ImMin(chunk_begin + chunk_size, count);
+        PrimReserve((chunk_end - chunk_begin) * idx_count, (chunk_end - chunk_begin) * vtx_count);
+        int written_count = 0;
+        for (int n = chunk_begin; n < chunk_end; n++)
+        {
+            const ImVec2& a = points[n * 2];
+            const ImVec2& b = points[n * 2 + 1];
+            if ((cols[n] & IM_COL32_A_MASK) == 0)
+                continue;
+            if (BatchIsCulled(clip_rect, ImMin(a.x, b.x) - extent, ImMin(a.y, b.y) - extent, ImMax(a.x, b.x) + extent, ImMax(a.y, b.y) + extent))
+            {
+                PrimCulledCount++;
+                continue;
+            }
+            const ImVec2 line_points[2] = { ImVec2(a.x + 0.5f, a.y + 0.5f), ImVec2(b.x + 0.5f, b.y + 0.5f) };
+            PolylineWrite(this, line_points, 2, cols[n], false, thickness);
+            written_count++;
+        }
+        PrimEmittedCount += written_count;
+        PrimUnreserve((chunk_end - chunk_begin - written_count) * idx_count, (chunk_end - chunk_begin - written_count) * vtx_count);
+    }
+}
+
+// points[] contains count*3 points: the 3 corners of each triangle
+void ImDrawList::AddTriangleFilledBatch(const ImVec2* points, const ImU32* cols, int count)
+{
+    const ImVec4 clip_rect = _ClipRectStack.Size ? _ClipRectStack.back() : _Data->ClipRectFullscreen;
+    const float extent = 1.0f; // AA fringe
+    int idx_count, vtx_count;
+    ConvexPolyFilledCalcPrimCount(Flags, 3, &idx_count, &vtx_count);
+    const int chunk_size = BatchCalcChunkSize(vtx_count);
+    for (int chunk_begin = 0; chunk_begin < count; chunk_begin += chunk_size)
+    {
+        const int chunk_end = ImMin(chunk_begin + chunk_size, count);
+        PrimReserve((chunk_end - chunk_begin) * idx_count, (chunk_end - chunk_begin) * vtx_count);
+        int written_count = 0;
+        for (int n = chunk_begin; n < chunk_end; n++)
+        {
+            const ImVec2* p = &points[n * 3];
+            const float min_x = ImMin(ImMin(p[0].x, p[1].x), p[2].x), max_x = ImMax(ImMax(p[0].x, p[1].x), p[2].x);
+            const float min_y = ImMin(ImMin(p[0].y, p[1].y), p[2].y), max_y = ImMax(ImMax(p[0].y, p[1].y), p[2].y);
+            if ((cols[n] & IM_COL32_A_MASK) == 0)
+                continue;
+            if (BatchIsCulled(clip_rect, min_x - extent, min_y - extent, max_x + extent, max_y + extent))
+            {
+                PrimCulledCount++;
+                continue;
+            }
+            ConvexPolyFilledWrite(this, p, 3, cols[n]);
+            written_count++;
+        }
+        PrimEmittedCount += written_count;
+        PrimUnreserve((chunk_end - chunk_begin - written_count) * idx_count, (chunk_end - chunk_begin - written_count) * vtx_count);
+    }
+}
+
+// Return the number of segments of a circle of the batch, 0 if there is nothing to draw, -1 if it is culled
+static inline int CircleBatchCalcSegmentCount(const ImDrawListSharedData* data, const ImVec4& clip_rect, const ImVec2& centre, float radius, ImU32 col, int num_segments)
+{
+    const float r = ImFabs(radius) + 1.0f; // AA fringe
+    if (radius == 0.0f || (col & IM_COL32_A_MASK) == 0)
+        return 0;
+    if (BatchIsCulled(clip_rect, centre.x - r, centre.y - r, centre.x + r, centre.y + r))
+        return -1;
+    return (num_segments > 0) ? num_segments : data->CalcCircleAutoSegmentCount(radius);
+}
+
+// With num_segments <= 0 the segment count of each circle depends on its radius, like with AddCircleFilled().
+// Unit circle vertices come from the shared table, or are computed once for the whole batch when there is none at the requested resolution.
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centres, const float* radii, const ImU32* cols, int count, int num_segments)
+{
+    if (num_segments > 0 && num_segments <= 2)
+        return;
+    const ImVec4 clip_rect = _ClipRectStack.Size ? _ClipRectStack.back() : _Data->ClipRectFullscreen;
+
+    // Use the end of _Path as scratch memory for the points of the current circle and the unit circle (preserving the path being built, if any)
+    const int max_points_count = (num_segments > 0) ? num_segments : IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX;
+    const int path_size = _Path.Size;
+    _Path.resize(path_size + max_points_count * 2);
+    ImVec2* circle_points = _Path.Data + path_size;
+    const ImVec2* unit_circle = NULL;
+    int unit_circle_points_count = 0;
+    if (num_segments > 0)
+    {
+        unit_circle = _Data->GetCircleVtx(num_segments);
+        if (unit_circle == NULL)
+        {
+            CircleCalcUnitVtx(circle_points + max_points_count, num_segments);
+            unit_circle = circle_points + max_points_count;
+        }
+        unit_circle_points_count = num_segments;
+    }
+
+    for (int chunk_begin = 0; chunk_begin < count; )
+    {
+        // Gather circles until the chunk is full, so we can reserve space for all of them at once
+        int chunk_end = chunk_begin;
+        int idx_total = 0, vtx_total = 0;
+        while (chunk_end < count && vtx_total < IM_DRAWLIST_BATCH_CHUNK_VTX_COUNT)
+        {
+            const int points_count = CircleBatchCalcSegmentCount(_Data, clip_rect, centres[chunk_end], radii[chunk_end], cols[chunk_end], num_segments);
+            if (points_count > 0)
+            {
+                int idx_count, vtx_count;
+                ConvexPolyFilledCalcPrimCount(Flags, points_count, &idx_count, &vtx_count);
+                idx_total += idx_count;
+                vtx_total += vtx_count;
+            }
+            chunk_end++;
+        }
+        if (vtx_total > 0)
+            PrimReserve(idx_total, vtx_total);
+        for (int n = chunk_begin; n < chunk_end; n++)
+        {
+            const int points_count = CircleBatchCalcSegmentCount(_Data, clip_rect, centres[n], radii[n], cols[n], num_segments);
+            if (points_count <= 0)
+            {
+                if (points_count < 0)
+                    PrimCulledCount++;
+                continue;
+            }
+            PrimEmittedCount++;
+            if (points_count != unit_circle_points_count)
+            {
+                unit_circle = _Data->GetCircleVtx(points_count); // Auto segment counts always have a table
+                unit_circle_points_count = points_count;
+            }
+            const ImVec2& centre = centres[n];
+            const float radius = radii[n];
+            for (int i = 0; i < points_count; i++)
+                circle_points[i] = ImVec2(centre.x + unit_circle[i].x * radius, centre.y + unit_circle[i].y * radius);
+            ConvexPolyFilledWrite(this, circle_points, points_count, cols[n]);
+        }
+        chunk_begin = chunk_end;
+    }
+    _Path.Size = path_size;
 }
 
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
@@ -1116,6 +1639,10 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
 
     IM_ASSERT(font->ContainerAtlas->TexID == _TextureIdStack.back());  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
 
+    // Text extends right and down from 'pos' (with some margin for glyphs overhanging their advance). Lines above the clipping rectangle are skipped by RenderText().
+    if (PrimCoarseCull(this, pos.x, pos.y, FLT_MAX, FLT_MAX, font_size))
+        return;
+
     ImVec4 clip_rect = _ClipRectStack.back();
     if (cpu_fine_clip_rect)
     {
@@ -1136,6 +1663,8 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& a, const Im
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (PrimCoarseCull(this, ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.x, b.x), ImMax(a.y, b.y), 0.0f))
+        return;
 
     const bool push_texture_id = _TextureIdStack.empty() || user_texture_id != _TextureIdStack.back();
     if (push_texture_id)
@@ -1152,6 +1681,10 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& a, cons
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    const float min_x = ImMin(ImMin(a.x, b.x), ImMin(c.x, d.x)), max_x = ImMax(ImMax(a.x, b.x), ImMax(c.x, d.x));
+    const float min_y = ImMin(ImMin(a.y, b.y), ImMin(c.y, d.y)), max_y = ImMax(ImMax(a.y, b.y), ImMax(c.y, d.y));
+    if (PrimCoarseCull(this, min_x, min_y, max_x, max_y, 0.0f))
+        return;
 
     const bool push_texture_id = _TextureIdStack.empty() || user_texture_id != _TextureIdStack.back();
     if (push_texture_id)
@@ -1174,6 +1707,8 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& a, c
         AddImage(user_texture_id, a, b, uv_a, uv_b, col);
         return;
     }
+    if (PrimCoarseCull(this, ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.x, b.x), ImMax(a.y, b.y), 1.0f))
+        return;
 
     const bool push_texture_id = _TextureIdStack.empty() || user_texture_id != _TextureIdStack.back();
     if (push_texture_id)
@@ -1181,7 +1716,7 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& a, c
 
     int vert_start_idx = VtxBuffer.Size;
     PathRect(a, b, rounding, rounding_corners);
-    PathFillConvex(col);
+    PathFillConvexNoCull(this, col);
     int vert_end_idx = VtxBuffer.Size;
     ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, a, b, uv_a, uv_b, true);
 
@@ -1189,6 +1724,202 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& a, c
         PopTextureID();
 }
 
+//-----------------------------------------------------------------------------
+// Stamps: geometry recorded once then replayed with a translation and a color tint, see ImDrawStamp.
+// - Replaying is a copy of vertices (adding the offset to positions) and indices (adding the base vertex index).
+// - A white tint leaves colors untouched, otherwise each channel is multiplied by the tint channel.
+//-----------------------------------------------------------------------------
+
+void ImDrawStamp::RecordBegin(const ImDrawList* draw_list)
+{
+    IM_ASSERT(_RecordCmdCount == -1 && "Mismatched RecordBegin()/RecordEnd() calls!");
+    _RecordVtxStart = draw_list->VtxBuffer.Size;
+    _RecordIdxStart = draw_list->IdxBuffer.Size;
+    _RecordCmdCount = draw_list->CmdBuffer.Size;
+    _RecordVtxCurrentIdx = draw_list->_VtxCurrentIdx;
+}
+
+void ImDrawStamp::RecordEnd(const ImDrawList* draw_list, const ImVec2& origin)
+{
+    IM_ASSERT(_RecordCmdCount != -1 && "Mismatched RecordBegin()/RecordEnd() calls!");
+
+    // Commands added while recording are only allowed when splitting at a new VtxOffset (large mesh support with 16-bit indices)
+    IM_ASSERT((_RecordCmdCount > 0 || draw_list->CmdBuffer.Size == 0) && "Recorded geometry must fit in a single draw command: don't change clip rect or texture while recording!");
+    for (int cmd_n = _RecordCmdCount; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+        const ImDrawCmd& first_cmd = draw_list->CmdBuffer[_RecordCmdCount - 1];
+        IM_ASSERT(memcmp(&cmd.ClipRect, &first_cmd.ClipRect, sizeof(cmd.ClipRect)) == 0 && cmd.TextureId == first_cmd.TextureId && cmd.UserCallback == NULL && "Recorded geometry must fit in a single draw command: don't change clip rect or texture while recording!");
+        IM_UNUSED(cmd);
+        IM_UNUSED(first_cmd);
+    }
+
+    const int vtx_count = draw_list->VtxBuffer.Size - _RecordVtxStart;
+    const int idx_count = draw_list->IdxBuffer.Size - _RecordIdxStart;
+    VtxBuffer.resize(vtx_count);
+    IdxBuffer.resize(idx_count);
+    BoundsMin = ImVec2(FLT_MAX, FLT_MAX);
+    BoundsMax = ImVec2(-FLT_MAX, -FLT_MAX);
+    for (int n = 0; n < vtx_count; n++)
+    {
+        ImDrawVert& v = VtxBuffer[n];
+        v = draw_list->VtxBuffer[_RecordVtxStart + n];
+        v.pos = ImVec2(v.pos) - origin;
+        BoundsMin = ImMin(BoundsMin, v.pos);
+        BoundsMax = ImMax(BoundsMax, v.pos);
+    }
+    if (vtx_count == 0)
+        BoundsMin = BoundsMax = ImVec2(0.0f, 0.0f);
+
+    // Rebase indices on the first recorded vertex. Indices of each command added by a VtxOffset split are relative to its VtxOffset.
+    int idx_end = draw_list->IdxBuffer.Size;
+    for (int cmd_n = draw_list->CmdBuffer.Size - 1; cmd_n >= 0 && cmd_n >= _RecordCmdCount - 1; cmd_n--)
+    {
+        const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+        const int idx_begin = (cmd_n == _RecordCmdCount - 1) ? _RecordIdxStart : idx_end - (int)cmd.ElemCount;
+        const unsigned int idx_base = (cmd_n == _RecordCmdCount - 1) ? _RecordVtxCurrentIdx : (unsigned int)_RecordVtxStart - cmd.VtxOffset;
+        for (int n = idx_begin; n < idx_end; n++)
+        {
+            const unsigned int idx = (unsigned int)draw_list->IdxBuffer[n] - idx_base;
+            IM_ASSERT(idx < (unsigned int)vtx_count && "Recorded indices must refer to recorded vertices!");
+            IdxBuffer[n - _RecordIdxStart] = (ImDrawIdx)idx;
+        }
+        idx_end = idx_begin;
+    }
+    _RecordVtxStart = _RecordIdxStart = _RecordCmdCount = -1;
+}
+
+static inline ImU32 StampTintColor(ImU32 col, ImU32 tint_col)
+{
+    // (c * (t + 1)) >> 8 is exact for t == 0 and t == 255
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ((((col >> shift) & 0xFF) * (((tint_col >> shift) & 0xFF) + 1)) >> 8) << shift;
+    return out;
+}
+
+static void StampWrite(const ImDrawStamp& stamp, float x, float y, ImU32 tint_col, ImDrawVert* vtx_write, ImDrawIdx* idx_write, unsigned int idx_base)
+{
+    const ImDrawVert* vtx_read = stamp.VtxBuffer.Data;
+    const ImDrawIdx* idx_read = stamp.IdxBuffer.Data;
+    const int vtx_count = stamp.VtxBuffer.Size;
+    const int idx_count = stamp.IdxBuffer.Size;
+    int n = 0;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    // Default ImDrawVert layout: 4 vertices == 80 bytes == 5 vectors of { pos.x, pos.y, uv.x, uv.y, col } in sequence.
+    // The offset is only added to position lanes: adding 0.0f to color bits which happen to form a NaN could alter them.
+    // The 4 colors are in lane 0 of vector 1, lane 1 of vector 2, lane 2 of vector 3 and lane 3 of vector 4.
+    const __m128 offsets[5] = { _mm_setr_ps(x, y, 0.0f, 0.0f), _mm_setr_ps(0.0f, x, y, 0.0f), _mm_setr_ps(0.0f, 0.0f, x, y), _mm_setr_ps(0.0f, 0.0f, 0.0f, x), _mm_setr_ps(y, 0.0f, 0.0f, 0.0f) };
+    const __m128 pos_masks[5] = { _mm_castsi128_ps(_mm_setr_epi32(-1, -1, 0, 0)), _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0)), _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, -1)), _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)), _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0)) };
+    const __m128 col_masks[5] = { _mm_setzero_ps(), _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0)), _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, 0)), _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, 0)), _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)) };
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tint_mul = _mm_add_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)tint_col), zero), _mm_set1_epi16(1));   // (t + 1) for each channel, twice
+    const bool tint = (tint_col != IM_COL32_WHITE);
+    for (; n + 4 <= vtx_count; n += 4)
+    {
+        const float* src = &vtx_read[n].pos.x;
+        float* dst = &vtx_write[n].pos.x;
+        __m128 v[5];
+        for (int k = 0; k < 5; k++)
+        {
+            v[k] = _mm_loadu_ps(src + k * 4);
+            v[k] = _mm_or_ps(_mm_add_ps(_mm_and_ps(v[k], pos_masks[k]), offsets[k]), _mm_andnot_ps(pos_masks[k], v[k]));
+        }
+        if (tint)
+        {
+            const __m128i cols = _mm_castps_si128(_mm_or_ps(_mm_or_ps(_mm_and_ps(v[1], col_masks[1]), _mm_and_ps(v[2], col_masks[2])), _mm_or_ps(_mm_and_ps(v[3], col_masks[3]), _mm_and_ps(v[4], col_masks[4]))));
+            const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(cols, zero), tint_mul), 8);
+            const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(cols, zero), tint_mul), 8);
+            const __m128 tinted = _mm_castsi128_ps(_mm_packus_epi16(lo, hi));
+            for (int k = 1; k < 5; k++)
+                v[k] = _mm_or_ps(_mm_andnot_ps(col_masks[k], v[k]), _mm_and_ps(col_masks[k], tinted));
+        }
+        for (int k = 0; k < 5; k++)
+            _mm_storeu_ps(dst + k * 4, v[k]);
+    }
+#endif
+    for (; n < vtx_count; n++)
+    {
+        vtx_write[n] = vtx_read[n];
+        vtx_write[n].pos = ImVec2(vtx_read[n].pos) + ImVec2(x, y);
+        if (tint_col != IM_COL32_WHITE)
+            vtx_write[n].col = StampTintColor(vtx_write[n].col, tint_col);
+    }
+
+    n = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        const __m128i base = _mm_set1_epi16((short)idx_base);
+        for (; n + 8 <= idx_count; n += 8)
+            _mm_storeu_si128((__m128i*)(idx_write + n), _mm_add_epi16(_mm_loadu_si128((const __m128i*)(idx_read + n)), base));
+    }
+    else if (sizeof(ImDrawIdx) == 4)
+    {
+        const __m128i base = _mm_set1_epi32((int)idx_base);
+        for (; n + 4 <= idx_count; n += 4)
+            _mm_storeu_si128((__m128i*)(idx_write + n), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(idx_read + n)), base));
+    }
+#endif
+    for (; n < idx_count; n++)
+        idx_write[n] = (ImDrawIdx)(idx_read[n] + idx_base);
+}
+
+void ImDrawList::AddStamp(const ImDrawStamp& stamp, const ImVec2& pos, ImU32 tint_col)
+{
+    if (stamp.IdxBuffer.Size == 0 || (tint_col & IM_COL32_A_MASK) == 0)
+        return;
+    if (PrimCoarseCull(this, pos.x + stamp.BoundsMin.x, pos.y + stamp.BoundsMin.y, pos.x + stamp.BoundsMax.x, pos.y + stamp.BoundsMax.y, 0.0f))
+        return;
+
+    PrimReserve(stamp.IdxBuffer.Size, stamp.VtxBuffer.Size);
+    StampWrite(stamp, pos.x, pos.y, tint_col, _VtxWritePtr, _IdxWritePtr, _VtxCurrentIdx);
+    _VtxWritePtr += stamp.VtxBuffer.Size;
+    _IdxWritePtr += stamp.IdxBuffer.Size;
+    _VtxCurrentIdx += stamp.VtxBuffer.Size;
+}
+
+void ImDrawList::AddStampBatch(const ImDrawStamp& stamp, const ImVec2* positions, const ImU32* tint_cols, int count)
+{
+    const int vtx_count = stamp.VtxBuffer.Size;
+    const int idx_count = stamp.IdxBuffer.Size;
+    if (idx_count == 0)
+        return;
+
+    const ImVec4 clip_rect = _ClipRectStack.Size ? _ClipRectStack.back() : _Data->ClipRectFullscreen;
+    const int chunk_size = BatchCalcChunkSize(vtx_count);
+    for (int chunk_begin = 0; chunk_begin < count; chunk_begin += chunk_size)
+    {
+        const int chunk_end = ImMin(chunk_begin + chunk_size, count);
+        PrimReserve((chunk_end - chunk_begin) * idx_count, (chunk_end - chunk_begin) * vtx_count);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_begin; n < chunk_end; n++)
+        {
+            const ImU32 tint_col = tint_cols ? tint_cols[n] : IM_COL32_WHITE;
+            if ((tint_col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImVec2 pos = positions[n];
+            if (BatchIsCulled(clip_rect, pos.x + stamp.BoundsMin.x, pos.y + stamp.BoundsMin.y, pos.x + stamp.BoundsMax.x, pos.y + stamp.BoundsMax.y))
+            {
+                PrimCulledCount++;
+                continue;
+            }
+            StampWrite(stamp, pos.x, pos.y, tint_col, vtx_write, idx_write, idx);
+            vtx_write += vtx_count;
+            idx_write += idx_count;
+            idx += vtx_count;
+        }
+        const int written_count = (int)(vtx_write - _VtxWritePtr) / vtx_count;
+        PrimEmittedCount += written_count;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve((chunk_end - chunk_begin - written_count) * idx_count, (chunk_end - chunk_begin - written_count) * vtx_count);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // ImDrawListSplitter
@@ -1344,14 +2075,84 @@ void ImDrawData::DeIndexAllBuffers()
 // or if there is a difference between your window resolution and framebuffer resolution.
 void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
 {
-    for (int i = 0; i < CmdListsCount; i++)
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = CmdLists[i];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
+            cmd->ClipRect = ImVec4(cmd->ClipRect.x * fb_scale.x, cmd->ClipRect.y * fb_scale.y, cmd->ClipRect.z * fb_scale.x, cmd->ClipRect.w * fb_scale.y);
+        }
+    }
+}
+
+// Append the commands of a command list to a merged command list, with offsets relative to the start of the merged buffers.
+static void MergeDrawCmds(ImVector<ImDrawCmd>* out_cmds, const ImDrawList* cmd_list, unsigned int global_vtx_offset, unsigned int global_idx_offset, bool keep_vtx_offset)
+{
+    out_cmds->resize(out_cmds->Size + cmd_list->CmdBuffer.Size);
+    ImDrawCmd* dst = out_cmds->Data + out_cmds->Size - cmd_list->CmdBuffer.Size;
+    for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++, dst++)
+    {
+        *dst = cmd_list->CmdBuffer.Data[cmd_i];
+        dst->VtxOffset = keep_vtx_offset ? dst->VtxOffset + global_vtx_offset : 0;
+        dst->IdxOffset += global_idx_offset;
+    }
+}
+
+// Helpers to copy the vertices and indices of all command lists into single contiguous buffers, to upload them in one call
+// instead of two per command list, or to write them directly into mapped GPU memory.
+// vtx_dst must have room for TotalVtxCount vertices and idx_dst for TotalIdxCount indices.
+// If 'out_cmds' is provided, it is filled with a copy of the commands of all command lists with their offsets rebased, so they can
+// be rendered without iterating CmdLists[]. User callbacks are copied as-is: if your callbacks need their parent command list,
+// iterate CmdLists[] and add the sum of VtxBuffer.Size/IdxBuffer.Size of the previous command lists to VtxOffset/IdxOffset instead.
+// - MergeBuffers(): indices are copied as-is, so commands must be drawn with their VtxOffset as a base vertex. With 16-bit indices
+//   this is the only way to render more than 64K vertices: it requires a renderer honoring VtxOffset (ImGuiBackendFlags_RendererHasVtxOffset).
+// - MergeBuffersIdx32(): indices are converted to 32-bit and made relative to the start of vtx_dst, so commands can be drawn without
+//   a base vertex (e.g. GL ES 3.0, software renderers).
+void ImDrawData::MergeBuffers(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst, ImVector<ImDrawCmd>* out_cmds) const
+{
+    if (out_cmds)
+        out_cmds->resize(0);
+    unsigned int global_vtx_offset = 0;
+    unsigned int global_idx_offset = 0;
+    for (int n = 0; n < CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = CmdLists[n];
+        memcpy(vtx_dst + global_vtx_offset, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst + global_idx_offset, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        if (out_cmds)
+            MergeDrawCmds(out_cmds, cmd_list, global_vtx_offset, global_idx_offset, true);
+        global_vtx_offset += (unsigned int)cmd_list->VtxBuffer.Size;
+        global_idx_offset += (unsigned int)cmd_list->IdxBuffer.Size;
+    }
+}
+
+void ImDrawData::MergeBuffersIdx32(ImDrawVert* vtx_dst, unsigned int* idx_dst, ImVector<ImDrawCmd>* out_cmds) const
+{
+    if (out_cmds)
+        out_cmds->resize(0);
+    unsigned int global_vtx_offset = 0;
+    unsigned int global_idx_offset = 0;
+    for (int n = 0; n < CmdListsCount; n++)
     {
-        ImDrawList* cmd_list = CmdLists[i];
+        const ImDrawList* cmd_list = CmdLists[n];
+        memcpy(vtx_dst + global_vtx_offset, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+
+        // Commands cover the index buffer contiguously, each of them with its own base vertex
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
-            ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
-            cmd->ClipRect = ImVec4(cmd->ClipRect.x * fb_scale.x, cmd->ClipRect.y * fb_scale.y, cmd->ClipRect.z * fb_scale.x, cmd->ClipRect.w * fb_scale.y);
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer.Data[cmd_i];
+            IM_ASSERT(pcmd->IdxOffset + pcmd->ElemCount <= (unsigned int)cmd_list->IdxBuffer.Size);
+            const ImDrawIdx* idx_read = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            unsigned int* idx_write = idx_dst + global_idx_offset + pcmd->IdxOffset;
+            const unsigned int vtx_base = global_vtx_offset + pcmd->VtxOffset;
+            for (unsigned int i = 0; i < pcmd->ElemCount; i++)
+                idx_write[i] = (unsigned int)idx_read[i] + vtx_base;
         }
+        if (out_cmds)
+            MergeDrawCmds(out_cmds, cmd_list, global_vtx_offset, global_idx_offset, false);
+        global_vtx_offset += (unsigned int)cmd_list->VtxBuffer.Size;
+        global_idx_offset += (unsigned int)cmd_list->IdxBuffer.Size;
     }
 }
 
@@ -1393,12 +2194,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos) - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos) - a, scale);
     }
 }
 
@@ -1481,6 +2282,14 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(91,0), ImVec2(17,22), ImVec2( 5, 0) }, // ImGuiMouseCursor_Hand
 };
 
+// Build identifiers are unique across atlases, so a cache keyed on one can't confuse a new atlas with a destroyed one allocated at the same address.
+static volatile ImU32 GImFontAtlasBuildIdCounter = 0;
+
+static void ImFontAtlasBuildUpdateBuildId(ImFontAtlas* atlas)
+{
+    atlas->BuildId = ImAtomicFetchAdd(&GImFontAtlasBuildIdCounter, 1) + 1;
+}
+
 ImFontAtlas::ImFontAtlas()
 {
     Locked = false;
@@ -1488,6 +2297,9 @@ ImFontAtlas::ImFontAtlas()
     TexID = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    CacheFilename = NULL;
+    ParallelForFn = NULL;
+    ParallelForUserData = NULL;
 
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
@@ -1496,6 +2308,8 @@ ImFontAtlas::ImFontAtlas()
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
+    DynamicData = NULL;
+    BuildId = 0;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1525,6 +2339,7 @@ void    ImFontAtlas::ClearInputData()
     CustomRects.clear();
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
+    ImFontAtlasBuildDestroyDynamicData(this); // Rasterizing more glyphs requires the TTF data
 }
 
 void    ImFontAtlas::ClearTexData()
@@ -1536,6 +2351,8 @@ void    ImFontAtlas::ClearTexData()
         IM_FREE(TexPixelsRGBA32);
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
+    TexDirtyRects.clear();
+    ImFontAtlasBuildDestroyDynamicData(this); // Rasterizing more glyphs requires the pixels
 }
 
 void    ImFontAtlas::ClearFonts()
@@ -1544,6 +2361,8 @@ void    ImFontAtlas::ClearFonts()
     for (int i = 0; i < Fonts.Size; i++)
         IM_DELETE(Fonts[i]);
     Fonts.clear();
+    ImFontAtlasBuildDestroyDynamicData(this);
+    ImFontAtlasBuildUpdateBuildId(this);
 }
 
 void    ImFontAtlas::Clear()
@@ -1777,7 +2596,242 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 bool    ImFontAtlas::Build()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    return ImFontAtlasBuildWithStbTruetype(this);
+    ImFontAtlasBuildUpdateBuildId(this);
+
+    // Reuse the output of a previous build with the exact same inputs, if available
+    const bool use_cache = (CacheFilename != NULL && !(Flags & ImFontAtlasFlags_DynamicGlyphs) && ConfigData.Size > 0);
+    ImVector<char> cache_key;
+    if (use_cache)
+    {
+        ImFontAtlasBuildRegisterDefaultCustomRects(this);
+        ImFontAtlasBuildCalcCacheKey(this, &cache_key);
+        if (ImFontAtlasBuildLoadCache(this, CacheFilename, cache_key))
+            return true;
+    }
+
+    if (!ImFontAtlasBuildWithStbTruetype(this))
+        return false;
+    if (use_cache)
+        ImFontAtlasBuildSaveCache(this, CacheFilename, cache_key);
+    return true;
+}
+
+//-------------------------------------------------------------------------
+// ImFontAtlas cache file
+//-------------------------------------------------------------------------
+// The cache file stores the output of a build: texture pixels (Alpha8), custom rectangles positions, and for each font its
+// metrics, glyphs and lookup tables. It is native endian and meant to be used on the machine which wrote it.
+// The key holds everything which affects the build output: ImFontConfig fields, glyph ranges, custom rectangles and atlas
+// settings are stored as-is, TTF/OTF data as its size and a 64-bit hash. The key stored in the file is compared byte for byte,
+// a cache file with a different key or format is ignored and overwritten.
+//-------------------------------------------------------------------------
+
+#define IM_FONTATLAS_CACHE_MAGIC    0x41464D49  // "IMFA"
+#define IM_FONTATLAS_CACHE_VERSION  4
+
+static int ImFontAtlasCacheFindFontIndex(ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+        if (atlas->Fonts[n] == font)
+            return n;
+    return -1;
+}
+
+static void ImFontAtlasCacheKeyAdd(ImVector<char>* key, const void* data, size_t data_size)
+{
+    const int off = key->Size;
+    key->resize(off + (int)data_size);
+    memcpy(key->Data + off, data, data_size);
+}
+
+void    ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas, ImVector<char>* out_key)
+{
+    out_key->resize(0);
+    const int header[] = { IM_FONTATLAS_CACHE_VERSION, (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, atlas->Fonts.Size, atlas->ConfigData.Size, atlas->CustomRects.Size };
+    ImFontAtlasCacheKeyAdd(out_key, header, sizeof(header));
+
+    for (int cfg_i = 0; cfg_i < atlas->ConfigData.Size; cfg_i++)
+    {
+        // Store fields one by one: the structure has padding and pointers
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_i];
+        const int cfg_ints[] = { cfg.FontDataSize, cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH ? 1 : 0, cfg.MergeMode ? 1 : 0, (int)cfg.RasterizerFlags, ImFontAtlasCacheFindFontIndex(atlas, cfg.DstFont) };
+        const float cfg_floats[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+        const ImU64 font_data_hash = ImHashData64(cfg.FontData, (size_t)cfg.FontDataSize); // 64-bit: fonts are too large to be stored in the key
+        ImFontAtlasCacheKeyAdd(out_key, cfg_ints, sizeof(cfg_ints));
+        ImFontAtlasCacheKeyAdd(out_key, cfg_floats, sizeof(cfg_floats));
+        ImFontAtlasCacheKeyAdd(out_key, &font_data_hash, sizeof(font_data_hash));
+
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] != 0)
+            ranges_count++;
+        ImFontAtlasCacheKeyAdd(out_key, &ranges_count, sizeof(ranges_count));
+        ImFontAtlasCacheKeyAdd(out_key, ranges, ranges_count * sizeof(ImWchar));
+    }
+
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_i];
+        const int rect_ints[] = { (int)r.ID, r.Width, r.Height, ImFontAtlasCacheFindFontIndex(atlas, r.Font) };
+        const float rect_floats[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        ImFontAtlasCacheKeyAdd(out_key, rect_ints, sizeof(rect_ints));
+        ImFontAtlasCacheKeyAdd(out_key, rect_floats, sizeof(rect_floats));
+    }
+}
+
+// Sequential reader over a cache file loaded in memory, with bounds checking
+struct ImFontAtlasCacheReader
+{
+    const char* Data;
+    const char* DataEnd;
+    bool        Error;
+
+    ImFontAtlasCacheReader(const void* data, size_t data_size) { Data = (const char*)data; DataEnd = Data + data_size; Error = false; }
+    bool        Read(void* dst, size_t size)    { if (Error || (size_t)(DataEnd - Data) < size) { Error = true; return false; } memcpy(dst, Data, size); Data += size; return true; }
+    int         ReadInt()                       { int v = 0; Read(&v, sizeof(v)); return v; }
+    float       ReadFloat()                     { float v = 0.0f; Read(&v, sizeof(v)); return v; }
+    template<typename T>
+    bool        ReadVector(ImVector<T>& v)      { int size = ReadInt(); if (Error || size < 0 || (size_t)(DataEnd - Data) / sizeof(T) < (size_t)size) { Error = true; return false; } v.resize(size); return Read(v.Data, (size_t)size * sizeof(T)); }
+};
+
+struct ImFontAtlasCacheWriter
+{
+    FILE*       File;
+    bool        Error;
+
+    ImFontAtlasCacheWriter(FILE* f)             { File = f; Error = false; }
+    void        Write(const void* src, size_t size) { if (size > 0 && fwrite(src, 1, size, File) != size) Error = true; }
+    void        WriteInt(int v)                 { Write(&v, sizeof(v)); }
+    void        WriteFloat(float v)             { Write(&v, sizeof(v)); }
+    template<typename T>
+    void        WriteVector(const ImVector<T>& v) { WriteInt(v.Size); Write(v.Data, (size_t)v.size_in_bytes()); }
+};
+
+bool    ImFontAtlasBuildLoadCache(ImFontAtlas* atlas, const char* filename, const ImVector<char>& key)
+{
+    size_t file_data_size = 0;
+    void* file_data = ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (!file_data)
+        return false;
+
+    ImFontAtlasCacheReader r(file_data, file_data_size);
+    ImVector<char> file_key;
+    bool ok = (r.ReadInt() == IM_FONTATLAS_CACHE_MAGIC) && (r.ReadInt() == IM_FONTATLAS_CACHE_VERSION) && r.ReadVector(file_key);
+    ok = ok && (file_key.Size == key.Size) && (memcmp(file_key.Data, key.Data, (size_t)key.Size) == 0);
+    ok = ok && (r.ReadInt() == atlas->Fonts.Size) && (r.ReadInt() == atlas->CustomRects.Size);
+    const int tex_width = r.ReadInt();
+    const int tex_height = r.ReadInt();
+    ok = ok && !r.Error && tex_width > 0 && tex_height > 0 && tex_width <= 0x10000 && tex_height <= 0x10000;
+    if (!ok)
+    {
+        IM_FREE(file_data);
+        return false;
+    }
+
+    // Clear atlas
+    atlas->TexID = (ImTextureID)NULL;
+    atlas->ClearTexData();
+    atlas->TexWidth = tex_width;
+    atlas->TexHeight = tex_height;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    atlas->TexUvWhitePixel.x = r.ReadFloat();
+    atlas->TexUvWhitePixel.y = r.ReadFloat();
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        atlas->CustomRects[rect_i].X = (unsigned short)r.ReadInt();
+        atlas->CustomRects[rect_i].Y = (unsigned short)r.ReadInt();
+    }
+
+    // Fonts
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        ImFont* font = atlas->Fonts[font_i];
+        font->ClearOutputData();
+        const int cfg_i = r.ReadInt();
+        font->ConfigData = (cfg_i >= 0 && cfg_i < atlas->ConfigData.Size) ? &atlas->ConfigData[cfg_i] : NULL;
+        font->ConfigDataCount = (short)r.ReadInt();
+        font->ContainerAtlas = r.ReadInt() ? atlas : NULL;
+        font->FontSize = r.ReadFloat();
+        font->Ascent = r.ReadFloat();
+        font->Descent = r.ReadFloat();
+        font->MetricsTotalSurface = r.ReadInt();
+        font->FallbackChar = (ImWchar)r.ReadInt();
+        font->FallbackAdvanceX = r.ReadFloat();
+        const int fallback_glyph_i = r.ReadInt();
+        r.ReadVector(font->Glyphs);
+        r.ReadVector(font->IndexPages);
+        r.ReadVector(font->IndexAdvanceX);
+        r.ReadVector(font->IndexLookup);
+        if (font->IndexAdvanceX.Size != font->IndexLookup.Size || (font->IndexLookup.Size & 0xFF) != 0)
+            r.Error = true;
+        for (int page_n = 0; page_n < font->IndexPages.Size && !r.Error; page_n++)
+            if (font->IndexPages[page_n] >= (font->IndexLookup.Size >> 8))
+                r.Error = true;
+        font->FallbackGlyph = (fallback_glyph_i >= 0 && fallback_glyph_i < font->Glyphs.Size) ? &font->Glyphs[fallback_glyph_i] : NULL;
+        font->DirtyLookupTables = false;
+    }
+
+    // Pixels
+    const size_t tex_size = (size_t)atlas->TexWidth * (size_t)atlas->TexHeight;
+    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
+    r.Read(atlas->TexPixelsAlpha8, tex_size);
+    IM_FREE(file_data);
+
+    if (r.Error)
+    {
+        // Truncated or corrupted file: leave the atlas in a state where it will be built again
+        for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+            atlas->Fonts[font_i]->ClearOutputData();
+        atlas->ClearTexData();
+        atlas->TexWidth = atlas->TexHeight = 0;
+        return false;
+    }
+    return true;
+}
+
+bool    ImFontAtlasBuildSaveCache(ImFontAtlas* atlas, const char* filename, const ImVector<char>& key)
+{
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
+    FILE* f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+
+    ImFontAtlasCacheWriter w(f);
+    w.WriteInt(IM_FONTATLAS_CACHE_MAGIC);
+    w.WriteInt(IM_FONTATLAS_CACHE_VERSION);
+    w.WriteVector(key);
+    w.WriteInt(atlas->Fonts.Size);
+    w.WriteInt(atlas->CustomRects.Size);
+    w.WriteInt(atlas->TexWidth);
+    w.WriteInt(atlas->TexHeight);
+    w.WriteFloat(atlas->TexUvWhitePixel.x);
+    w.WriteFloat(atlas->TexUvWhitePixel.y);
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        w.WriteInt(atlas->CustomRects[rect_i].X);
+        w.WriteInt(atlas->CustomRects[rect_i].Y);
+    }
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        const ImFont* font = atlas->Fonts[font_i];
+        w.WriteInt(font->ConfigData ? (int)(font->ConfigData - atlas->ConfigData.Data) : -1);
+        w.WriteInt(font->ConfigDataCount);
+        w.WriteInt(font->ContainerAtlas ? 1 : 0);
+        w.WriteFloat(font->FontSize);
+        w.WriteFloat(font->Ascent);
+        w.WriteFloat(font->Descent);
+        w.WriteInt(font->MetricsTotalSurface);
+        w.WriteInt(font->FallbackChar);
+        w.WriteFloat(font->FallbackAdvanceX);
+        w.WriteInt(font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1);
+        w.WriteVector(font->Glyphs);
+        w.WriteVector(font->IndexPages);
+        w.WriteVector(font->IndexAdvanceX);
+        w.WriteVector(font->IndexLookup);
+    }
+    w.Write(atlas->TexPixelsAlpha8, (size_t)atlas->TexWidth * (size_t)atlas->TexHeight);
+    fclose(f);
+    return !w.Error;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -1822,6 +2876,156 @@ struct ImFontBuildDstData
     ImBoolVector        GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Allocator used by stb_truetype from jobs running on other threads (ImFontAtlas::ParallelForFn).
+// We don't call ImGui::MemAlloc() from them because it updates non-atomic metrics.
+struct ImFontBuildJobAllocator
+{
+    void*               (*AllocFunc)(size_t sz, void* user_data);
+    void                (*FreeFunc)(void* ptr, void* user_data);
+    void*               UserData;
+};
+
+// A range of glyphs from a same source font, measured or rasterized by a single call of ImFontAtlasBuildJobGatherRects() or ImFontAtlasBuildJobRenderGlyphs()
+struct ImFontBuildJob
+{
+    int                 SrcIndex;
+    int                 GlyphsStart;
+    int                 GlyphsCount;
+};
+
+struct ImFontBuildJobsData
+{
+    ImFontAtlas*            Atlas;
+    ImFontBuildSrcData*     SrcTmpArray;
+    stbtt_pack_context*     PackContext;
+    ImFontBuildJobAllocator* Allocator;     // NULL when running jobs serially
+    ImVector<ImFontBuildJob> Jobs;
+};
+
+static void* ImFontAtlasBuildStbttAlloc(size_t sz, void* user_data)
+{
+    if (ImFontBuildJobAllocator* allocator = (ImFontBuildJobAllocator*)user_data)
+        return allocator->AllocFunc(sz, allocator->UserData);
+    return IM_ALLOC(sz);
+}
+
+static void ImFontAtlasBuildStbttFree(void* ptr, void* user_data)
+{
+    if (ImFontBuildJobAllocator* allocator = (ImFontBuildJobAllocator*)user_data)
+        allocator->FreeFunc(ptr, allocator->UserData);
+    else
+        IM_FREE(ptr);
+}
+
+// Gather the sizes of rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+static void ImFontAtlasBuildJobGatherRects(void* jobs_data_opaque, int job_index)
+{
+    ImFontBuildJobsData* jobs_data = (ImFontBuildJobsData*)jobs_data_opaque;
+    const ImFontBuildJob& job = jobs_data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = jobs_data->SrcTmpArray[job.SrcIndex];
+    const ImFontConfig& cfg = jobs_data->Atlas->ConfigData[job.SrcIndex];
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = jobs_data->Allocator;
+
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&font_info, -cfg.SizePixels);
+    const int padding = jobs_data->Atlas->TexGlyphPadding;
+    for (int glyph_i = job.GlyphsStart; glyph_i < job.GlyphsStart + job.GlyphsCount; glyph_i++)
+    {
+        int x0, y0, x1, y1;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&font_info, src_tmp.GlyphsList[glyph_i]);
+        IM_ASSERT(glyph_index_in_font != 0);
+        stbtt_GetGlyphBitmapBoxSubpixel(&font_info, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+        src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+        src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+    }
+}
+
+// Render/rasterize font characters into the texture. Jobs write to distinct packed rectangles.
+static void ImFontAtlasBuildJobRenderGlyphs(void* jobs_data_opaque, int job_index)
+{
+    ImFontBuildJobsData* jobs_data = (ImFontBuildJobsData*)jobs_data_opaque;
+    const ImFontBuildJob& job = jobs_data->Jobs[job_index];
+    ImFontAtlas* atlas = jobs_data->Atlas;
+    ImFontBuildSrcData& src_tmp = jobs_data->SrcTmpArray[job.SrcIndex];
+    const ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = jobs_data->Allocator;
+
+    // stb_truetype temporarily modifies the pack context while rendering, use a copy
+    stbtt_pack_context spc = *jobs_data->PackContext;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.GlyphsStart;
+    pack_range.chardata_for_range += job.GlyphsStart;
+    pack_range.num_chars = job.GlyphsCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphsStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphsCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
+// Run jobs with ImFontAtlas::ParallelForFn if provided, serially otherwise
+static void ImFontAtlasBuildRunJobs(ImFontBuildJobsData* jobs_data, void (*job_fn)(void* job_data, int job_index))
+{
+    ImFontAtlas* atlas = jobs_data->Atlas;
+    if (atlas->ParallelForFn != NULL && jobs_data->Jobs.Size > 1)
+    {
+        ImFontBuildJobAllocator allocator;
+        ImGui::GetAllocatorFunctions(&allocator.AllocFunc, &allocator.FreeFunc, &allocator.UserData);
+        jobs_data->Allocator = &allocator;
+        atlas->ParallelForFn(job_fn, jobs_data, jobs_data->Jobs.Size, atlas->ParallelForUserData);
+        jobs_data->Allocator = NULL;
+    }
+    else
+    {
+        for (int job_n = 0; job_n < jobs_data->Jobs.Size; job_n++)
+            job_fn(jobs_data, job_n);
+    }
+}
+
+// Source of a glyph which hasn't been rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontDynamicGlyphSrc
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[] and ImFontAtlasDynamicData::FontInfos[], -1 if the glyph doesn't need rasterizing
+    int                 Codepoint;
+    unsigned short      RectW, RectH;       // Size to pack, including padding and oversampling
+};
+
+// Per destination font: one entry for each glyph of ImFont::Glyphs[]
+struct ImFontDynamicFontData
+{
+    ImVector<ImFontDynamicGlyphSrc> GlyphsSrc;
+};
+
+// Data kept alive after Build() to rasterize glyphs on demand (ImFontAtlasFlags_DynamicGlyphs)
+// Glyphs which are not rasterized yet are marked with negative texture coordinates, see ImFont::FindGlyph().
+struct ImFontAtlasDynamicData
+{
+    stbtt_pack_context              PackContext;    // Packer state, pixels point to atlas->TexPixelsAlpha8
+    ImVector<stbtt_fontinfo>        FontInfos;      // Per source font (atlas->ConfigData[])
+    ImVector<ImFontDynamicFontData> Fonts;          // Per destination font (atlas->Fonts[])
+    int                             GlyphsRasterized;
+    int                             GlyphsPackFailed;
+
+    ImFontAtlasDynamicData()        { memset(&PackContext, 0, sizeof(PackContext)); GlyphsRasterized = GlyphsPackFailed = 0; }
+    ~ImFontAtlasDynamicData()
+    {
+        stbtt_PackEnd(&PackContext);
+        for (int n = 0; n < Fonts.Size; n++)
+            Fonts[n].~ImFontDynamicFontData();
+    }
+};
+
+static void ImFontAtlasBuildDynamicSetup(ImFontAtlas* atlas, ImFontBuildSrcData* src_tmp_array, int total_surface);
+
 static void UnpackBoolVectorToFlatIndexList(const ImBoolVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -1936,7 +3140,13 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
-    int total_surface = 0;
+    // Measuring and rendering are split in jobs of at most GLYPHS_PER_JOB glyphs, which may run on multiple threads (ImFontAtlas::ParallelForFn).
+    const int GLYPHS_PER_JOB = 256;
+    ImFontBuildJobsData jobs_data;
+    jobs_data.Atlas = atlas;
+    jobs_data.SrcTmpArray = src_tmp_array.Data;
+    jobs_data.PackContext = NULL;
+    jobs_data.Allocator = NULL;
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -1960,20 +3170,30 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
 
-        // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
-        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
-        const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i += GLYPHS_PER_JOB)
         {
-            int x0, y0, x1, y1;
-            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
-            IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            ImFontBuildJob job;
+            job.SrcIndex = src_i;
+            job.GlyphsStart = glyph_i;
+            job.GlyphsCount = ImMin(GLYPHS_PER_JOB, src_tmp.GlyphsCount - glyph_i);
+            jobs_data.Jobs.push_back(job);
         }
     }
+    ImFontAtlasBuildRunJobs(&jobs_data, ImFontAtlasBuildJobGatherRects);
+
+    int total_surface = 0;
+    for (int rect_i = 0; rect_i < buf_rects.Size; rect_i++)
+        total_surface += buf_rects[rect_i].w * buf_rects[rect_i].h;
+
+    // Dynamic glyphs: we know the size of every glyph, pack and rasterize them later on demand.
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        ImFontAtlasBuildDynamicSetup(atlas, src_tmp_array.Data, total_surface);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+            src_tmp_array[src_i].~ImFontBuildSrcData();
+        ImFontAtlasBuildFinish(atlas);
+        return true;
+    }
 
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
@@ -2017,27 +3237,10 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    jobs_data.PackContext = &spc;
+    ImFontAtlasBuildRunJobs(&jobs_data, ImFontAtlasBuildJobRenderGlyphs);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
-        {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
-        src_tmp.Rects = NULL;
-    }
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -2090,6 +3293,227 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     return true;
 }
 
+// Allocate a fixed-size texture, pack the custom rectangles and register every glyph with its final advance but without rasterizing it.
+static void ImFontAtlasBuildDynamicSetup(ImFontAtlas* atlas, ImFontBuildSrcData* src_tmp_array, int total_surface)
+{
+    ImFontAtlasDynamicData* data = IM_NEW(ImFontAtlasDynamicData)();
+    atlas->DynamicData = data;
+
+    // Size the texture for all requested glyphs, but never more than a square texture.
+    atlas->TexWidth = (atlas->TexDesiredWidth > 0) ? atlas->TexDesiredWidth : 1024;
+    atlas->TexHeight = ImMin(ImUpperPowerOfTwo(ImMax(total_surface / atlas->TexWidth + 1, 128)), atlas->TexWidth);
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
+    memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+
+    // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
+    const int tex_height = atlas->TexHeight;
+    stbtt_PackBegin(&data->PackContext, atlas->TexPixelsAlpha8, atlas->TexWidth, atlas->TexHeight, 0, atlas->TexGlyphPadding, NULL);
+    ImFontAtlasBuildPackCustomRects(atlas, data->PackContext.pack_info);
+    atlas->TexHeight = tex_height;
+
+    data->FontInfos.resize(atlas->ConfigData.Size);
+    data->Fonts.resize(atlas->Fonts.Size);
+    memset(data->Fonts.Data, 0, (size_t)data->Fonts.size_in_bytes());
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        data->FontInfos[src_i] = src_tmp.FontInfo;
+        if (src_tmp.GlyphsCount == 0)
+            continue;
+
+        ImFontConfig& cfg = atlas->ConfigData[src_i];
+        ImFont* dst_font = cfg.DstFont;
+        ImVector<ImFontDynamicGlyphSrc>& glyphs_src = data->Fonts[src_tmp.DstIndex].GlyphsSrc;
+
+        const float font_scale = stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels);
+        int unscaled_ascent, unscaled_descent, unscaled_line_gap;
+        stbtt_GetFontVMetrics(&src_tmp.FontInfo, &unscaled_ascent, &unscaled_descent, &unscaled_line_gap);
+
+        const float ascent = ImFloor(unscaled_ascent * font_scale + ((unscaled_ascent > 0.0f) ? +1 : -1));
+        const float descent = ImFloor(unscaled_descent * font_scale + ((unscaled_descent > 0.0f) ? +1 : -1));
+        ImFontAtlasBuildSetupFont(atlas, dst_font, &cfg, ascent, descent);
+
+        // Same advance as stbtt_PackFontRangesRenderIntoRects() would output
+        const float scale = (cfg.SizePixels > 0) ? font_scale : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+        {
+            const int codepoint = src_tmp.GlyphsList[glyph_i];
+            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint);
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+            const float char_advance_x_mod = ImClamp(scale * advance, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+
+            // Empty glyphs (e.g. space) don't need rasterizing
+            const stbrp_rect& r = src_tmp.Rects[glyph_i];
+            const bool is_empty = stbtt_IsGlyphEmpty(&src_tmp.FontInfo, glyph_index_in_font) != 0;
+            const float uv = is_empty ? 0.0f : -1.0f;
+            dst_font->AddGlyph((ImWchar)codepoint, 0.0f, 0.0f, 0.0f, 0.0f, uv, uv, uv, uv, char_advance_x_mod);
+
+            glyphs_src.resize(dst_font->Glyphs.Size);
+            ImFontDynamicGlyphSrc& glyph_src = glyphs_src.back();
+            glyph_src.SrcIndex = is_empty ? -1 : src_i;
+            glyph_src.Codepoint = codepoint;
+            glyph_src.RectW = (unsigned short)r.w;
+            glyph_src.RectH = (unsigned short)r.h;
+        }
+    }
+}
+
+void ImFontAtlasBuildDestroyDynamicData(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicData == NULL)
+        return;
+    IM_DELETE(atlas->DynamicData);
+    atlas->DynamicData = NULL;
+}
+
+static void ImFontAtlasBuildAddDirtyRect(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    // Merge with a touching rectangle if any. Past a small amount of rectangles, merge everything into their bounding box:
+    // the skyline packer scatters glyphs around the texture and many small uploads are more costly than a larger one.
+    const int DIRTY_RECTS_MAX = 16;
+    const int gap = atlas->TexGlyphPadding + 1;
+    ImVector<ImFontAtlasDirtyRect>& rects = atlas->TexDirtyRects;
+    int merge_n = -1;
+    for (int n = 0; n < rects.Size && merge_n == -1; n++)
+        if (x <= rects[n].X + rects[n].Width + gap && x + w + gap >= rects[n].X && y <= rects[n].Y + rects[n].Height + gap && y + h + gap >= rects[n].Y)
+            merge_n = n;
+    if (merge_n == -1 && rects.Size >= DIRTY_RECTS_MAX)
+    {
+        int x0 = rects[0].X, y0 = rects[0].Y, x1 = rects[0].X + rects[0].Width, y1 = rects[0].Y + rects[0].Height;
+        for (int n = 1; n < rects.Size; n++)
+        {
+            x0 = ImMin(x0, (int)rects[n].X);
+            y0 = ImMin(y0, (int)rects[n].Y);
+            x1 = ImMax(x1, rects[n].X + rects[n].Width);
+            y1 = ImMax(y1, rects[n].Y + rects[n].Height);
+        }
+        rects.resize(1);
+        rects[0].X = (unsigned short)x0;
+        rects[0].Y = (unsigned short)y0;
+        rects[0].Width = (unsigned short)(x1 - x0);
+        rects[0].Height = (unsigned short)(y1 - y0);
+        merge_n = 0;
+    }
+    if (merge_n == -1)
+    {
+        ImFontAtlasDirtyRect r;
+        r.X = (unsigned short)x;
+        r.Y = (unsigned short)y;
+        r.Width = (unsigned short)w;
+        r.Height = (unsigned short)h;
+        rects.push_back(r);
+        return;
+    }
+    ImFontAtlasDirtyRect& r = rects[merge_n];
+    const int x0 = ImMin(x, (int)r.X), y0 = ImMin(y, (int)r.Y);
+    const int x1 = ImMax(x + w, r.X + r.Width), y1 = ImMax(y + h, r.Y + r.Height);
+    r.X = (unsigned short)x0;
+    r.Y = (unsigned short)y0;
+    r.Width = (unsigned short)(x1 - x0);
+    r.Height = (unsigned short)(y1 - y0);
+}
+
+// Called by ImFont::FindGlyph() on first use of a glyph registered by ImFontAtlasBuildDynamicSetup().
+// If we can't rasterize it (texture full or atlas data cleared), the glyph is displayed using the fallback glyph texture coordinates.
+void ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImFontGlyph* glyph)
+{
+    IM_ASSERT(glyph->U0 < 0.0f && glyph >= font->Glyphs.begin() && glyph < font->Glyphs.end());
+    ImFontAtlasDynamicData* data = atlas->DynamicData;
+    const ImFontDynamicGlyphSrc* glyph_src = NULL;
+    if (data != NULL)
+        for (int font_n = 0; font_n < atlas->Fonts.Size && font_n < data->Fonts.Size; font_n++)
+            if (atlas->Fonts[font_n] == font)
+            {
+                const ImVector<ImFontDynamicGlyphSrc>& glyphs_src = data->Fonts[font_n].GlyphsSrc;
+                const int glyph_n = (int)(glyph - font->Glyphs.Data);
+                if (glyph_n < glyphs_src.Size && glyphs_src[glyph_n].SrcIndex >= 0)
+                    glyph_src = &glyphs_src[glyph_n];
+                break;
+            }
+
+    // Pack
+    stbrp_rect r;
+    memset(&r, 0, sizeof(r));
+    if (glyph_src != NULL)
+    {
+        r.w = (stbrp_coord)glyph_src->RectW;
+        r.h = (stbrp_coord)glyph_src->RectH;
+        stbrp_pack_rects((stbrp_context*)data->PackContext.pack_info, &r, 1);
+        if (!r.was_packed)
+            data->GlyphsPackFailed++;
+    }
+    if (!r.was_packed)
+    {
+        const ImFontGlyph* fallback_glyph = font->FallbackGlyph;
+        if (fallback_glyph != NULL && fallback_glyph != glyph && fallback_glyph->U0 >= 0.0f)
+        {
+            glyph->X0 = fallback_glyph->X0; glyph->Y0 = fallback_glyph->Y0; glyph->X1 = fallback_glyph->X1; glyph->Y1 = fallback_glyph->Y1;
+            glyph->U0 = fallback_glyph->U0; glyph->V0 = fallback_glyph->V0; glyph->U1 = fallback_glyph->U1; glyph->V1 = fallback_glyph->V1;
+        }
+        else
+        {
+            glyph->X0 = glyph->Y0 = glyph->X1 = glyph->Y1 = 0.0f;
+            glyph->U0 = glyph->V0 = glyph->U1 = glyph->V1 = 0.0f;
+        }
+        return;
+    }
+
+    // Render/rasterize into the texture
+    const ImFontConfig& cfg = atlas->ConfigData[glyph_src->SrcIndex];
+    const stbtt_fontinfo* font_info = &data->FontInfos[glyph_src->SrcIndex];
+    int codepoint = glyph_src->Codepoint;
+    stbtt_packedchar pc;
+    stbtt_pack_range pack_range;
+    memset(&pack_range, 0, sizeof(pack_range));
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = &codepoint;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &pc;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    data->PackContext.pixels = atlas->TexPixelsAlpha8;
+    stbtt_PackFontRangesRenderIntoRects(&data->PackContext, font_info, &pack_range, 1, &r);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r.x, r.y, r.w, r.h, atlas->TexWidth * 1);
+    }
+    if (atlas->TexPixelsRGBA32)
+        for (int y = r.y; y < r.y + r.h; y++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + y * atlas->TexWidth + r.x;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + y * atlas->TexWidth + r.x;
+            for (int n = r.w; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+    ImFontAtlasBuildAddDirtyRect(atlas, r.x, r.y, r.w, r.h);
+    data->GlyphsRasterized++;
+
+    // Setup glyph, same as the regular builder
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + (float)(int)(font->Ascent + 0.5f);
+    const float char_advance_x_org = pc.xadvance;
+    const float char_advance_x_mod = ImClamp(char_advance_x_org, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+    float char_off_x = font_off_x;
+    if (char_advance_x_org != char_advance_x_mod)
+        char_off_x += cfg.PixelSnapH ? (float)(int)((char_advance_x_mod - char_advance_x_org) * 0.5f) : (char_advance_x_mod - char_advance_x_org) * 0.5f;
+
+    stbtt_aligned_quad q;
+    float dummy_x = 0.0f, dummy_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &dummy_x, &dummy_y, &q, 0);
+    glyph->X0 = q.x0 + char_off_x;
+    glyph->Y0 = q.y0 + font_off_y;
+    glyph->X1 = q.x1 + char_off_x;
+    glyph->Y1 = q.y1 + font_off_y;
+    glyph->U0 = q.s0;
+    glyph->V0 = q.t0;
+    glyph->U1 = q.s1;
+    glyph->V1 = q.t1;
+}
+
 void ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtlas* atlas)
 {
     if (atlas->CustomRectIds[0] >= 0)
@@ -2484,6 +3908,7 @@ void    ImFont::ClearOutputData()
     FontSize = 0.0f;
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
+    IndexPages.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
     FallbackGlyph = NULL;
@@ -2493,6 +3918,12 @@ void    ImFont::ClearOutputData()
     MetricsTotalSurface = 0;
 }
 
+// Offset of codepoint 'c' within IndexAdvanceX[] and IndexLookup[]. Requires (c >> 8) < IndexPages.Size
+static inline int ImFontIndexOffset(const ImFont* font, unsigned int c)
+{
+    return ((int)font->IndexPages.Data[c >> 8] << 8) | (int)(c & 0xFF);
+}
+
 void ImFont::BuildLookupTable()
 {
     int max_codepoint = 0;
@@ -2500,16 +3931,13 @@ void ImFont::BuildLookupTable()
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IndexPages.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
     DirtyLookupTables = false;
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
-    {
-        int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
-    }
+        SetGlyphIndex(Glyphs[i].Codepoint, (ImWchar)i, Glyphs[i].AdvanceX);
 
     // Create a glyph to handle TAB
     // FIXME: Needs proper TAB handling but it needs to be contextualized (or we could arbitrary say that each string starts at "column 0" ?)
@@ -2521,13 +3949,12 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size-1);
+        SetGlyphIndex(tab_glyph.Codepoint, (ImWchar)(Glyphs.Size-1), tab_glyph.AdvanceX);
     }
 
     FallbackGlyph = FindGlyphNoFallback(FallbackChar);
     FallbackAdvanceX = FallbackGlyph ? FallbackGlyph->AdvanceX : 0.0f;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
 }
@@ -2538,13 +3965,37 @@ void ImFont::SetFallbackChar(ImWchar c)
     BuildLookupTable();
 }
 
+// Make codepoints up to 'new_size' addressable. Blocks of 256 codepoints all point to the shared empty page until SetGlyphIndex() is called for them.
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
+    const int new_pages_count = (new_size + 255) >> 8;
+    if (new_pages_count <= IndexPages.Size)
         return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    if (IndexLookup.empty())
+    {
+        IndexAdvanceX.resize(256, -1.0f);
+        IndexLookup.resize(256, (ImWchar)-1);
+    }
+    IndexPages.resize(new_pages_count, 0);
+}
+
+void ImFont::SetGlyphIndex(ImWchar c, ImWchar glyph_index, float advance_x)
+{
+    GrowIndex((int)c + 1);
+    ImU16& page = IndexPages[c >> 8];
+    if (page == 0)
+    {
+        // Allocate a page, initialized as a copy of the empty page
+        page = (ImU16)(IndexLookup.Size >> 8);
+        IndexAdvanceX.resize(IndexAdvanceX.Size + 256);
+        IndexLookup.resize(IndexLookup.Size + 256);
+        memcpy(&IndexAdvanceX.Data[page << 8], &IndexAdvanceX.Data[0], 256 * sizeof(float));
+        memcpy(&IndexLookup.Data[page << 8], &IndexLookup.Data[0], 256 * sizeof(ImWchar));
+    }
+    const int offset = ImFontIndexOffset(this, c);
+    IndexAdvanceX[offset] = advance_x;
+    IndexLookup[offset] = glyph_index;
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -2575,36 +4026,49 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    int index_size = IndexLookup.Size;
+    int index_size = IndexPages.Size << 8;
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst < index_size && IndexLookup.Data[ImFontIndexOffset(this, dst)] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
     if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const ImWchar src_glyph_index = (src < index_size) ? IndexLookup.Data[ImFontIndexOffset(this, src)] : (ImWchar)-1;
+    const float src_advance_x = (src < index_size) ? IndexAdvanceX.Data[ImFontIndexOffset(this, src)] : 1.0f;
+    SetGlyphIndex(dst, src_glyph_index, src_advance_x);
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    if ((c >> 8) >= IndexPages.Size)
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[ImFontIndexOffset(this, c)];
     if (i == (ImWchar)-1)
         return FallbackGlyph;
-    return &Glyphs.Data[i];
+    const ImFontGlyph* glyph = &Glyphs.Data[i];
+    if (glyph->U0 < 0.0f) // Not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+        ImFontAtlasBuildDynamicGlyph(ContainerAtlas, (ImFont*)this, (ImFontGlyph*)glyph);
+    return glyph;
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    if ((c >> 8) >= IndexPages.Size)
         return NULL;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[ImFontIndexOffset(this, c)];
     if (i == (ImWchar)-1)
         return NULL;
-    return &Glyphs.Data[i];
+    const ImFontGlyph* glyph = &Glyphs.Data[i];
+    if (glyph->U0 < 0.0f) // Not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+        ImFontAtlasBuildDynamicGlyph(ContainerAtlas, (ImFont*)this, (ImFontGlyph*)glyph);
+    return glyph;
+}
+
+bool ImFont::HasGlyph(ImWchar c) const
+{
+    if ((c >> 8) >= IndexPages.Size)
+        return false;
+    return IndexLookup.Data[ImFontIndexOffset(this, c)] != (ImWchar)-1;
 }
 
 const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
@@ -2632,10 +4096,33 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     const char* word_end = text;
     const char* prev_word_end = NULL;
     bool inside_word = true;
+    const float* ascii_advance_x = IndexPages.Size > 0 ? &IndexAdvanceX.Data[ImFontIndexOffset(this, 0)] : NULL;
 
     const char* s = text;
     while (s < text_end)
     {
+        // Fast path for runs of ASCII word characters, same as the generic code below for non-blank, non-punctuation characters
+        if (inside_word && ascii_advance_x != NULL)
+        {
+            const char* run_end = ImTextFindPrintableAsciiEnd(s, text_end);
+            for (; s < run_end; s++)
+            {
+                const char c = *s;
+                if (c == ' ' || c == '.' || c == ',' || c == ';' || c == '!' || c == '?' || c == '\"')
+                    break;
+                word_width += ascii_advance_x[(unsigned char)c];
+                word_end = s + 1;
+                if (line_width + word_width > wrap_width)
+                {
+                    if (word_width < wrap_width)
+                        s = prev_word_end ? prev_word_end : word_end;
+                    return s;
+                }
+            }
+            if (s >= text_end)
+                break;
+        }
+
         unsigned int c = (unsigned int)*s;
         const char* next_s;
         if (c < 0x80)
@@ -2661,7 +4148,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const float char_width = ((int)(c >> 8) < IndexPages.Size ? IndexAdvanceX.Data[ImFontIndexOffset(this, c)] : FallbackAdvanceX);
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -2719,6 +4206,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    const float* ascii_advance_x = IndexPages.Size > 0 ? &IndexAdvanceX.Data[ImFontIndexOffset(this, 0)] : NULL;
 
     const char* s = text_begin;
     while (s < text_end)
@@ -2751,6 +4239,22 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Fast path for runs of printable ASCII characters: no decoding, no special characters, direct access to the advances page
+        if (ascii_advance_x != NULL && (signed char)*s >= 0x20)
+        {
+            const char* run_end = ImTextFindPrintableAsciiEnd(s, (word_wrap_eol && word_wrap_eol < text_end) ? word_wrap_eol : text_end);
+            for (; s < run_end; s++)
+            {
+                const float char_width = ascii_advance_x[(unsigned char)*s] * scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+            }
+            if (s < run_end)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -2778,7 +4282,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const float char_width = ((int)(c >> 8) < IndexPages.Size ? IndexAdvanceX.Data[ImFontIndexOffset(this, c)] : FallbackAdvanceX) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -2868,6 +4372,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    const ImWchar* ascii_lookup = (IndexPages.Size > 0 && !cpu_fine_clip) ? &IndexLookup.Data[ImFontIndexOffset(this, 0)] : NULL;
 
     while (s < text_end)
     {
@@ -2897,6 +4402,45 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             }
         }
 
+        // Fast path for runs of printable ASCII characters: no decoding, no special characters, direct access to the glyph index page.
+        // Same output as the generic code below (without cpu_fine_clip).
+        if (ascii_lookup != NULL && (signed char)*s >= 0x20)
+        {
+            const char* run_end = ImTextFindPrintableAsciiEnd(s, (word_wrap_eol && word_wrap_eol < text_end) ? word_wrap_eol : text_end);
+            for (; s < run_end; s++)
+            {
+                const char c = *s;
+                const ImWchar glyph_index = ascii_lookup[(unsigned char)c];
+                const ImFontGlyph* glyph = (glyph_index != (ImWchar)-1) ? &Glyphs.Data[glyph_index] : FallbackGlyph;
+                if (glyph == NULL)
+                    continue;
+                if (glyph->U0 < 0.0f) // Not rasterized yet (ImFontAtlasFlags_DynamicGlyphs)
+                    ImFontAtlasBuildDynamicGlyph(ContainerAtlas, (ImFont*)this, (ImFontGlyph*)glyph);
+
+                if (c != ' ')
+                {
+                    float x1 = x + glyph->X0 * scale;
+                    float x2 = x + glyph->X1 * scale;
+                    float y1 = y + glyph->Y0 * scale;
+                    float y2 = y + glyph->Y1 * scale;
+                    if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+                    {
+                        idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+                        idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+                        vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(glyph->U0, glyph->V0);
+                        vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(glyph->U1, glyph->V0);
+                        vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(glyph->U1, glyph->V1);
+                        vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(glyph->U0, glyph->V1);
+                        vtx_write += 4;
+                        vtx_current_idx += 4;
+                        idx_write += 6;
+                    }
+                }
+                x += glyph->AdvanceX * scale;
+            }
+            continue;
+        }
+
         // Decode and advance source
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
@@ -2979,10 +4523,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                     {
                         idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                         idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                        vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(u1, v1);
+                        vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(u2, v1);
+                        vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(u2, v2);
+                        vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(u1, v2);
                         vtx_write += 4;
                         vtx_current_idx += 4;
                         idx_write += 6;
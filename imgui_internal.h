@@ -35,6 +35,18 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _InterlockedCompareExchange, _InterlockedExchange, _InterlockedExchangeAdd
+#endif
+
+// Enable SSE2/NEON intrinsics if available
+#if (defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(IMGUI_DISABLE_SIMD)
+#define IMGUI_ENABLE_SSE
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON) && !defined(IMGUI_DISABLE_SIMD)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -84,9 +96,11 @@ struct ImGuiSettingsHandler;        // Storage for one type registered in the .i
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
+struct ImGuiTextLayoutCache;        // LRU cache for text measurements
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
 struct ImGuiWindowSettings;         // Storage for window settings stored in .ini file (we keep one of those even if the actual window wasn't instanced during this session)
+struct ImGuiWrappedTextCache;       // Wrapped lines of a large word-wrapped text
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
@@ -165,17 +179,36 @@ IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, cons
 // Helpers: Misc
 IMGUI_API ImU32         ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImU32         ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+IMGUI_API ImU32         ImHashDataFast(const void* data, size_t data_size, ImU32 seed = 0); // Word-at-a-time hash. Used by ImHashData()/ImHashStr() if IMGUI_USE_FAST_HASH is defined, otherwise they use CRC32.
+IMGUI_API ImU64         ImHashData64(const void* data, size_t data_size, ImU64 seed = 0);  // MurmurHash64A with a fixed byte order. Results never change, use for persistent data (e.g. ImFontAtlas cache files).
+IMGUI_API ImU32         ImHashHashedLabel(const ImGuiHashedLabel& label, ImU32 seed = 0);   // == ImHashStr(label.Label, 0, seed), without hashing the string
 IMGUI_API void*         ImFileLoadToMemory(const char* filename, const char* file_open_mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 IMGUI_API FILE*         ImFileOpen(const char* filename, const char* file_open_mode);
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
+IMGUI_API const char*   ImTextFindPrintableAsciiEnd(const char* in_text, const char* in_text_end);                      // return end of the run of printable ASCII characters (0x20..0x7E) starting at in_text
 static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 #define ImQsort         qsort
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImU32     ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
 
+// Helpers: Atomic operations on 32-bit values, for the few helpers which can be called from other threads (e.g. ImGuiTextLog::Push())
+// Loads have acquire semantic, stores have release semantic, read-modify-write operations are full barriers.
+#if defined(_MSC_VER) && !defined(__clang__)
+static inline ImU32     ImAtomicLoad(volatile ImU32* p)                 { return (ImU32)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+static inline void      ImAtomicStore(volatile ImU32* p, ImU32 v)       { _InterlockedExchange((volatile long*)p, (long)v); }
+static inline ImU32     ImAtomicFetchAdd(volatile ImU32* p, ImU32 v)    { return (ImU32)_InterlockedExchangeAdd((volatile long*)p, (long)v); }
+static inline bool      ImAtomicCompareExchange(volatile ImU32* p, ImU32 expected, ImU32 desired) { return (ImU32)_InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == expected; }
+#else
+static inline ImU32     ImAtomicLoad(volatile ImU32* p)                 { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void      ImAtomicStore(volatile ImU32* p, ImU32 v)       { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline ImU32     ImAtomicFetchAdd(volatile ImU32* p, ImU32 v)    { return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST); }
+static inline bool      ImAtomicCompareExchange(volatile ImU32* p, ImU32 expected, ImU32 desired) { return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); }
+#endif
+
 // Helpers: Geometry
 IMGUI_API ImVec2        ImLineClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& p);
 IMGUI_API bool          ImTriangleContainsPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p);
@@ -557,6 +590,7 @@ struct IMGUI_API ImRect
     void        ClipWithFull(const ImRect& r)       { Min = ImClamp(Min, r.Min, r.Max); Max = ImClamp(Max, r.Min, r.Max); } // Full version, ensure both points are fully clipped.
     void        Floor()                             { Min.x = (float)(int)Min.x; Min.y = (float)(int)Min.y; Max.x = (float)(int)Max.x; Max.y = (float)(int)Max.y; }
     bool        IsInverted() const                  { return Min.x > Max.x || Min.y > Max.y; }
+    ImVec4      ToVec4() const                      { return ImVec4(Min.x, Min.y, Max.x, Max.y); }
 };
 
 // Type information associated to one ImGuiDataType. Retrieve with DataTypeGetInfo().
@@ -725,30 +759,70 @@ struct ImGuiColumns
     }
 };
 
+// Circle tessellation
+// AddCircle(), AddCircleFilled() and PathArcTo() with num_segments <= 0 use enough segments to keep the polygon within CurveTessellationTol
+// pixels of the circle, clamped to [MIN, MAX] and rounded up to one of the resolutions of the unit circle table (8, 12, 16, 24, 32, 48 ... 512).
+#define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN     8
+#define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX     512
+#define IM_DRAWLIST_CIRCLE_VTX_RES_COUNT        13      // Number of resolutions in ImDrawListSharedData::CircleVtx[]
+#define IM_DRAWLIST_CIRCLE_VTX_COUNT            1772    // Sum of all resolutions
+#define IM_DRAWLIST_CIRCLE_SEGMENT_COUNTS       64      // Auto segment counts are cached for integer radii below this value
+
 // Data shared between all ImDrawList instances
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas
     ImFont*         Font;                       // Current/default font (optional, for simplified AddText overload)
     float           FontSize;                   // Current/default font size (optional, for simplified AddText overload)
-    float           CurveTessellationTol;
+    float           CurveTessellationTol;       // Use SetCurveTessellationTol() to modify, so the cached circle segment counts are updated
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
 
     // Const data
     // FIXME: Bake rounded corners fill/borders in atlas
     ImVec2          CircleVtx12[12];
+    ImVec2          CircleVtx[IM_DRAWLIST_CIRCLE_VTX_COUNT];                // Unit circle vertices at each resolution, stored one after the other
+    ImU16           CircleSegmentCounts[IM_DRAWLIST_CIRCLE_SEGMENT_COUNTS]; // Auto segment count for each integer radius, computed from CircleSegmentCountsTol
+    float           CircleSegmentCountsTol;
 
     ImDrawListSharedData();
+    void            SetCurveTessellationTol(float tol);
+    int             CalcCircleAutoSegmentCount(float radius) const;
+    const ImVec2*   GetCircleVtx(int num_segments) const;   // Return NULL if there is no table at this resolution
+};
+
+// Draw list rendered by the last call to Render(), compared with the next frame to compute ImDrawData::DamageRects[]
+struct ImDrawListDamageInfo
+{
+    ImDrawList*             DrawList;
+    ImU32                   Hash;               // Hash of vertices, indices and draw commands
+    ImRect                  Rect;               // Bounding box of vertices, clipped by draw commands and display
+    int                     VtxStart, IdxStart, CmdStart;   // Copy of the contents in ImDrawDataBuilder::DamageVtx[]/DamageIdx[]/DamageCmds[], compared when hashes are equal
+    int                     VtxCount, IdxCount, CmdCount;
+    bool                    CanCompare;         // false if the draw list has user callbacks (we don't know what they render)
+    bool                    Matched;            // Found in the next frame
 };
 
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
 
+    // Damage tracking (io.ConfigDrawDataDamageRects)
+    ImVector<ImDrawListDamageInfo> DamageInfo[2];// Draw lists of the current and previous frame, in rendering order
+    ImVector<ImDrawVert>    DamageVtx[2];        // Copy of the vertices of the draw lists in DamageInfo[]
+    ImVector<ImDrawIdx>     DamageIdx[2];        // Copy of the indices of the draw lists in DamageInfo[]
+    ImVector<ImDrawCmd>     DamageCmds[2];       // Copy of the non-empty draw commands of the draw lists in DamageInfo[]
+    ImGuiStorage            DamageInfoMap;       // Hash of draw list pointer -> index + 1 in DamageInfo[1]
+    ImVector<ImVec4>        DamageRects;         // Output, pointed to by ImDrawData::DamageRects
+    ImRect                  DamageDisplayRect;   // Display rectangle of the previous frame, everything is damaged when it changes
+    ImVec2                  DamageFramebufferScale;
+    bool                    DamageInfoValid;     // DamageInfo[1] holds the previous frame
+
+    ImDrawDataBuilder()     { DamageFramebufferScale = ImVec2(0.0f, 0.0f); DamageInfoValid = false; }
     void Clear()            { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].resize(0); }
-    void ClearFreeMemory()  { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].clear(); }
+    void ClearFreeMemory()  { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].clear(); for (int n = 0; n < IM_ARRAYSIZE(DamageInfo); n++) { DamageInfo[n].clear(); DamageVtx[n].clear(); DamageIdx[n].clear(); DamageCmds[n].clear(); } DamageInfoMap.Clear(); DamageRects.clear(); DamageInfoValid = false; }
     IMGUI_API void FlattenIntoSingleLayer();
+    IMGUI_API void BuildDamageRects(ImDrawData* draw_data, bool track_damage);
 };
 
 struct ImGuiNavMoveResult
@@ -774,7 +848,8 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasCollapsed       = 1 << 3,
     ImGuiNextWindowDataFlags_HasSizeConstraint  = 1 << 4,
     ImGuiNextWindowDataFlags_HasFocus           = 1 << 5,
-    ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6
+    ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6,
+    ImGuiNextWindowDataFlags_HasContentHash     = 1 << 7
 };
 
 // Storage for SetNexWindow** functions
@@ -793,6 +868,7 @@ struct ImGuiNextWindowData
     ImGuiSizeCallback           SizeCallback;
     void*                       SizeCallbackUserData;
     float                       BgAlphaVal;
+    ImGuiID                     ContentHashVal;
     ImVec2                      MenuBarOffsetMinVal;    // *Always on* This is not exposed publicly, so we don't clear it.
         
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
@@ -803,7 +879,8 @@ enum ImGuiNextItemDataFlags_
 {
     ImGuiNextItemDataFlags_None     = 0,
     ImGuiNextItemDataFlags_HasWidth = 1 << 0,
-    ImGuiNextItemDataFlags_HasOpen  = 1 << 1
+    ImGuiNextItemDataFlags_HasOpen  = 1 << 1,
+    ImGuiNextItemDataFlags_HasTextVersion = 1 << 2
 };
 
 struct ImGuiNextItemData
@@ -812,11 +889,91 @@ struct ImGuiNextItemData
     float                       Width;          // Set by SetNextItemWidth().
     bool                        OpenVal;        // Set by SetNextItemOpen() function.
     ImGuiCond                   OpenCond;
+    ImU32                       TextVersion;    // Set by SetNextItemTextVersion().
 
     ImGuiNextItemData()         { memset(this, 0, sizeof(*this)); }
     inline void ClearFlags()    { Flags = ImGuiNextItemDataFlags_None; }
 };
 
+//-----------------------------------------------------------------------------
+// Text layout cache
+//-----------------------------------------------------------------------------
+
+// Cached result of a ImFont::CalcTextSizeA() call.
+// Entries are keyed by a hash of the text contents and of the layout parameters (font, size, max width, wrap width).
+// A copy of the text is kept and compared on lookup, so a hash collision can't return the size of another text.
+struct ImGuiTextLayoutCacheEntry
+{
+    ImGuiID         Key;            // Hash of text contents + parameters
+    int             TextOffset;     // Copy of text contents in ImGuiTextLayoutCache::TextBuf[] (TextLen bytes, not zero-terminated)
+    const ImFont*   Font;
+    float           FontSize;
+    float           MaxWidth;
+    float           WrapWidth;
+    int             TextLen;
+    int             RemainingOffset;// Offset of 'remaining' output from start of text
+    ImVec2          Size;           // Output of CalcTextSizeA()
+    int             LastFrameUsed;
+    int             HashNext;       // Next entry in the same hash bucket, or next free entry
+    int             LruPrev;        // Toward most recently used
+    int             LruNext;        // Toward least recently used
+};
+
+// LRU cache for text measurements (used by CalcTextSize(), RenderTextEllipsis()).
+// Static UI calls the same measurements every frame: this avoids decoding and accumulating glyph advances again.
+// The cache is bounded to 'Capacity' entries. Entries are evicted from the least recently used end in NewFrame(), at most 'EvictionBudget' per frame.
+// Insertion simply fails (and the result is not cached) if the cache is already full of entries waiting to be evicted.
+// Texts of all entries are copied in a single buffer, compacted instead of growing when at least half of it belongs to evicted entries.
+struct ImGuiTextLayoutCache
+{
+    ImVector<ImGuiTextLayoutCacheEntry> Entries;
+    ImVector<int>   Buckets;        // Index of first entry for each hash bucket, -1 if empty
+    ImVector<char>  TextBuf;        // Copies of entries texts
+    int             TextBufUnused;  // Bytes of TextBuf[] used by evicted entries
+    int             FreeIdx;        // First free entry, -1 if none
+    int             LruHead;        // Most recently used entry
+    int             LruTail;        // Least recently used entry
+    int             Count;          // Number of live entries
+    ImU32           AtlasBuildId;   // Copy of ImFontAtlas::BuildId, cleared when fonts are rebuilt
+
+    // Settings
+    int             Capacity;       // Maximum number of entries. Set to 0 to disable the cache.
+    int             EvictionBudget; // Maximum number of entries evicted per frame (when over capacity, or unused for more than 'MaxAge' frames)
+    int             MaxAge;         // Entries unused for this number of frames are evicted (within the eviction budget)
+    int             MinTextLen;     // Shorter strings are measured directly, as hashing them costs about as much as measuring them
+
+    // Statistics (for the current frame, and the previous one)
+    int             Hits, Misses, Evictions;
+    int             HitsLastFrame, MissesLastFrame, EvictionsLastFrame;
+
+    ImGuiTextLayoutCache()          { TextBufUnused = 0; FreeIdx = LruHead = LruTail = -1; Count = 0; AtlasBuildId = 0; Capacity = 2048; EvictionBudget = 64; MaxAge = 60; MinTextLen = 4; Hits = Misses = Evictions = HitsLastFrame = MissesLastFrame = EvictionsLastFrame = 0; }
+    void            Clear()         { Entries.clear(); Buckets.clear(); TextBuf.clear(); TextBufUnused = 0; FreeIdx = LruHead = LruTail = -1; Count = 0; }
+};
+
+// Wrapped lines of a large word-wrapped text (used by TextEx() when a wrap position is set, see GetWrappedTextCache()).
+// Laying out a multi-megabyte text takes tens of milliseconds, so it is done once and spread over several frames, and rendering only touches the visible lines.
+// Entries are keyed by text pointer, length and layout parameters, and validated every time they are used with either the version given by
+// SetNextItemTextVersion(), or a hash of the whole contents (much cheaper than laying them out, but still ~0.5 ms per MB).
+struct ImGuiWrappedTextCache
+{
+    const char*     Text;               // Only used as a key, never dereferenced outside of a call providing the same text
+    int             TextLen;
+    ImU32           TextStamp;          // Version given by SetNextItemTextVersion(), or ImHashDataFast() of the contents
+    bool            TextStampIsVersion;
+    const ImFont*   Font;
+    float           FontSize;
+    float           WrapWidth;
+    ImU32           AtlasBuildId;       // Copy of ImFontAtlas::BuildId
+    ImVector<int>   LineOffsets;        // Offset of the beginning of each wrapped line
+    float           Width;              // Width of the widest line built so far
+    int             BuildOffset;        // Text laid out so far (== TextLen when complete). The last line of LineOffsets[] is unfinished until then.
+    int             BuildWrapEolOffset; // Pending wrap position returned by CalcWordWrapPositionA(), -1 if none
+    int             LastFrameUsed;
+
+    ImGuiWrappedTextCache()         { Text = NULL; TextLen = 0; TextStamp = 0; TextStampIsVersion = false; Font = NULL; FontSize = WrapWidth = Width = 0.0f; AtlasBuildId = 0; BuildOffset = 0; BuildWrapEolOffset = -1; LastFrameUsed = -1; }
+    bool            IsBuilt() const { return BuildOffset >= TextLen; }
+};
+
 //-----------------------------------------------------------------------------
 // Tabs
 //-----------------------------------------------------------------------------
@@ -852,6 +1009,8 @@ struct ImGuiContext
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImGuiTextLayoutCache    TextLayoutCache;                    // Cache for CalcTextSize() and other text measurements
+    ImVector<ImGuiWrappedTextCache*> WrappedTextCaches;         // Wrapped lines of large word-wrapped texts (see GetWrappedTextCache())
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -903,6 +1062,7 @@ struct ImGuiContext
     // Shared stacks
     ImVector<ImGuiColorMod> ColorModifiers;                     // Stack for PushStyleColor()/PopStyleColor()
     ImVector<ImGuiStyleMod> StyleModifiers;                     // Stack for PushStyleVar()/PopStyleVar()
+    ImGuiID                 StyleHash;                          // Hash of Style, computed on demand for SetNextWindowContentHash(). Reset to 0 by NewFrame() and PushStyleXXX()/PopStyleXXX() calls.
     ImVector<ImFont*>       FontStack;                          // Stack for PushFont()/PopFont()
     ImVector<ImGuiPopupData>OpenPopupStack;                     // Which popups are open (persistent)
     ImVector<ImGuiPopupData>BeginPopupStack;                    // Which level of BeginPopup() we are in (reset every frame)
@@ -1081,6 +1241,8 @@ struct ImGuiContext
         LastActiveId = 0;
         LastActiveIdTimer = 0.0f;
 
+        StyleHash = 0;
+
         NavWindow = NULL;
         NavId = NavActivateId = NavActivateDownId = NavActivatePressedId = NavInputId = 0;
         NavJustTabbedId = NavJustMovedToId = NavJustMovedToMultiSelectScopeId = NavNextActivateId = 0;
@@ -1317,6 +1479,9 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImDrawList              DrawListDiscard;                    // Receives the draw calls issued while DrawListInst is being reused (DrawListReused), so they are discarded.
+    ImGuiID                 DrawListReuseHash;                  // Hash of the state DrawListInst was generated from (see SetNextWindowContentHash()), 0 if it cannot be reused.
+    bool                    DrawListReused;                     // Set during the frame where DrawListInst is submitted as-is from last frame. Items are skipped.
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
@@ -1333,9 +1498,11 @@ public:
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
+    ImGuiID     GetID(const ImGuiHashedLabel& label);
     ImGuiID     GetIDNoKeepAlive(const char* str, const char* str_end = NULL);
     ImGuiID     GetIDNoKeepAlive(const void* ptr);
     ImGuiID     GetIDNoKeepAlive(int n);
+    ImGuiID     GetIDNoKeepAlive(const ImGuiHashedLabel& label);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
 
     // We don't use g.FontSize because the window may be != g.CurrentWidow.
@@ -1461,6 +1628,9 @@ namespace ImGui
     IMGUI_API void          SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond cond = 0);
 
     IMGUI_API void          SetCurrentFont(ImFont* font);
+    IMGUI_API ImVec2        CalcTextSizeCached(const ImFont* font, float font_size, float max_width, float wrap_width, const char* text, const char* text_end, const char** remaining = NULL); // Same as ImFont::CalcTextSizeA() using g.TextLayoutCache
+    IMGUI_API void          ClearTextLayoutCache();
+    IMGUI_API ImGuiWrappedTextCache* GetWrappedTextCache(const char* text, const char* text_end, float wrap_width, int min_lines_count, const ImU32* text_version = NULL); // Using current font. 'text_version': see SetNextItemTextVersion(), NULL to hash the contents. Lines are built incrementally: at least 'min_lines_count' lines are available unless the text has fewer.
     inline ImFont*          GetDefaultFont() { ImGuiContext& g = *GImGui; return g.IO.FontDefault ? g.IO.FontDefault : g.IO.Fonts->Fonts[0]; }
 
     // Init
@@ -1659,6 +1829,11 @@ IMGUI_API void              ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtl
 IMGUI_API void              ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
 IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImFontGlyph* glyph);
+IMGUI_API void              ImFontAtlasBuildDestroyDynamicData(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas, ImVector<char>* out_key);
+IMGUI_API bool              ImFontAtlasBuildLoadCache(ImFontAtlas* atlas, const char* filename, const ImVector<char>& key);
+IMGUI_API bool              ImFontAtlasBuildSaveCache(ImFontAtlas* atlas, const char* filename, const ImVector<char>& key);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
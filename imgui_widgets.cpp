@@ -112,6 +112,7 @@ static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const
 // [SECTION] Widgets: Text, etc.
 //-------------------------------------------------------------------------
 // - TextUnformatted()
+// - TextUnformattedBuffer()
 // - Text()
 // - TextV()
 // - TextColored()
@@ -214,6 +215,38 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
         ItemSize(text_size);
         ItemAdd(bb, 0);
     }
+    else if (text_end - text > 2000 && !g.LogEnabled)
+    {
+        // Long word-wrapped text!
+        // - Wrapped lines are laid out once by GetWrappedTextCache(), spread over several frames for very large texts, and we only render visible lines.
+        // - Until the layout is complete, the height of the remaining text is extrapolated from the lines built so far.
+        const float wrap_width = CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x);
+        const float line_height = GetTextLineHeight();
+        const int line_first = ImMax((int)((window->ClipRect.Min.y - text_pos.y) / line_height), 0);
+        const int line_last = ImMax((int)((window->ClipRect.Max.y - text_pos.y) / line_height), -1);
+        const ImU32* text_version = (g.NextItemData.Flags & ImGuiNextItemDataFlags_HasTextVersion) ? &g.NextItemData.TextVersion : NULL;
+        ImGuiWrappedTextCache* cache = GetWrappedTextCache(text_begin, text_end, wrap_width, line_last + 2, text_version); // +1 to know where the last visible line ends
+        int lines_count = cache->LineOffsets.Size;
+        if (!cache->IsBuilt())
+            lines_count += (int)((double)(cache->TextLen - cache->BuildOffset) * cache->LineOffsets.Size / ImMax(cache->BuildOffset, 1));
+        const ImVec2 text_size((float)(int)(cache->Width + 0.95f), lines_count * line_height);
+
+        ImRect bb(text_pos, text_pos + text_size);
+        ItemSize(text_size);
+        if (!ItemAdd(bb, 0))
+            return;
+
+        // Render visible lines, trimming the carriage return or blanks where they were broken
+        const int line_end_n = ImMin(line_last + 1, cache->IsBuilt() ? cache->LineOffsets.Size : cache->LineOffsets.Size - 1);
+        for (int line_n = line_first; line_n < line_end_n; line_n++)
+        {
+            const char* line = text_begin + cache->LineOffsets[line_n];
+            const char* line_end = (line_n + 1 < cache->LineOffsets.Size) ? text_begin + cache->LineOffsets[line_n + 1] : text_end;
+            while (line_end > line && (line_end[-1] == '\n' || ImCharIsBlankA(line_end[-1])))
+                line_end--;
+            RenderText(ImVec2(text_pos.x, text_pos.y + line_n * line_height), line, line_end, false);
+        }
+    }
     else
     {
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
@@ -234,6 +267,65 @@ void ImGui::TextUnformatted(const char* text, const char* text_end)
     TextEx(text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
 }
 
+// Same as TextUnformatted(buf->begin(), buf->end()) with support for chunked storage.
+// Chunks entirely outside of the clipping rectangle are skipped using their lines count, without reading their text.
+void ImGui::TextUnformattedBuffer(const ImGuiTextBuffer* buf)
+{
+    if (buf->ChunkSize == 0)
+    {
+        TextEx(buf->begin(), buf->end(), ImGuiTextFlags_NoWidthForLargeClippedText);
+        return;
+    }
+    if (buf->Chunks.Size == 0)
+    {
+        TextEx("", NULL, ImGuiTextFlags_NoWidthForLargeClippedText);
+        return;
+    }
+
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+
+    // Every chunk but the last one ends with a '\n' (see ImGuiTextBuffer), so lines are never split across chunks.
+    // Like the long text path of TextEx(), only the width of visible lines is measured and we can't skip anything when logging text.
+    ImGuiContext& g = *GImGui;
+    const ImVec2 text_pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+    const float line_height = GetTextLineHeight();
+    const float clip_min_y = window->ClipRect.Min.y;
+    const float clip_max_y = window->ClipRect.Max.y;
+    ImVec2 pos = text_pos;
+    float text_width = 0.0f;
+    for (int chunk_n = 0; chunk_n < buf->Chunks.Size; chunk_n++)
+    {
+        const ImGuiTextBuffer::ImGuiTextChunk& chunk = buf->Chunks[chunk_n];
+        const int chunk_lines_count = chunk.LinesCount + ((chunk.Size > 0 && chunk.Data[chunk.Size - 1] != '\n') ? 1 : 0);
+        const float chunk_height = chunk_lines_count * line_height;
+        if (!g.LogEnabled && (pos.y + chunk_height < clip_min_y || pos.y > clip_max_y))
+        {
+            pos.y += chunk_height;
+            continue;
+        }
+        const char* chunk_end = chunk.Data + chunk.Size;
+        for (const char* line = chunk.Data; line < chunk_end; pos.y += line_height)
+        {
+            const char* line_end = (const char*)memchr(line, '\n', chunk_end - line);
+            if (!line_end)
+                line_end = chunk_end;
+            if (g.LogEnabled || (pos.y + line_height >= clip_min_y && pos.y <= clip_max_y))
+            {
+                text_width = ImMax(text_width, CalcTextSize(line, line_end).x);
+                RenderText(pos, line, line_end, false);
+            }
+            line = line_end + 1;
+        }
+    }
+
+    const ImVec2 text_size(text_width, pos.y - text_pos.y);
+    ImRect bb(text_pos, text_pos + text_size);
+    ItemSize(text_size);
+    ItemAdd(bb, 0);
+}
+
 void ImGui::Text(const char* fmt, ...)
 {
     va_list args;
@@ -3532,7 +3624,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         password_font->ContainerAtlas = g.Font->ContainerAtlas;
         password_font->FallbackGlyph = glyph;
         password_font->FallbackAdvanceX = glyph->AdvanceX;
-        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
+        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexPages.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
         PushFont(password_font);
     }
 
@@ -5023,6 +5115,14 @@ bool ImGui::TreeNode(const char* label)
     return TreeNodeBehavior(window->GetID(label), 0, label, NULL);
 }
 
+bool ImGui::TreeNode(const ImGuiHashedLabel& label)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return TreeNodeBehavior(window->GetID(label), 0, label.Label, NULL);
+}
+
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
 {
     return TreeNodeExV(str_id, 0, fmt, args);
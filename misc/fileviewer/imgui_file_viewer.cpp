@@ -0,0 +1,492 @@
+// imgui_file_viewer.cpp
+// Read-only viewer for large text files (logs, CSV, etc.), backed by a memory-mapped file.
+// See imgui_file_viewer.h for usage and notes.
+
+// Changelog:
+// - v0.10: Initial version.
+
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "imgui.h"
+#include "imgui_file_viewer.h"
+#include "imgui_internal.h"     // ImGuiWindow, ScrollbarEx(), ImTextStrFromUtf8()
+#include <string.h>             // memchr, strcmp
+#include <atomic>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>              // open
+#include <sys/mman.h>           // mmap, munmap
+#include <sys/stat.h>           // fstat
+#include <unistd.h>             // close
+#endif
+
+// Background threads publish their progress (and check for cancellation) every FILEVIEWER_PUBLISH_SIZE bytes.
+static const ImU64  FILEVIEWER_PUBLISH_SIZE     = 1024 * 1024;
+static const int    FILEVIEWER_CHECKPOINT_SHIFT = 6;    // The line index stores the offset of one line every 64 lines
+static const ImU64  FILEVIEWER_CHECKPOINT_MASK  = (1 << FILEVIEWER_CHECKPOINT_SHIFT) - 1;
+static const float  FILEVIEWER_WHEEL_LINES      = 5.0f; // Lines scrolled per mouse wheel step
+static const ImU64  FILEVIEWER_SCROLLBAR_LINES_MAX = 1 << 30; // ScrollbarEx() rounds the scroll position to an int
+
+//-------------------------------------------------------------------------
+// Internal state
+//-------------------------------------------------------------------------
+
+// Append-only array written by one background thread while being read by the main thread.
+// Blocks are never moved: the table of blocks is allocated for the maximum size beforehand, and Size is published after writing elements.
+template<typename T>
+struct ImGuiFileViewerArray
+{
+    enum { BlockShift = 14, BlockSize = 1 << BlockShift };
+    T**                 Blocks;
+    size_t              BlocksCount;
+    std::atomic<size_t> Size;
+
+    ImGuiFileViewerArray()                      { Blocks = NULL; BlocksCount = 0; Size = 0; }
+    const T&            operator[](size_t i) const { return Blocks[i >> BlockShift][i & (BlockSize - 1)]; }
+};
+
+struct ImGuiFileViewerMatch
+{
+    ImU64               Offset;                 // Offset of the beginning of the line
+    ImU64               LineNo;
+};
+
+struct ImGuiFileViewerState
+{
+    const char*         Data;                   // Mapped file contents (read-only)
+    ImU64               Size;
+    void*               (*AllocFunc)(size_t size, void* user_data); // Used by background threads, as ImGui::MemAlloc() updates the context metrics
+    void                (*FreeFunc)(void* ptr, void* user_data);
+    void*               AllocatorUserData;
+
+    // Line index (written by IndexThread)
+    ImGuiFileViewerArray<ImU64> LineCheckpoints;// Offset of the beginning of every 64th line
+    std::atomic<ImU64>  LinesCount;             // Number of lines indexed, published after LineCheckpoints[]
+    std::atomic<ImU64>  IndexedSize;
+    std::atomic<bool>   IndexCancel;
+    std::thread         IndexThread;
+
+    // Search (written by SearchThread)
+    bool                SearchActive;
+    ImGuiTextFilter     SearchFilter;           // Copy of the filter being searched, as the original can be modified by the main thread
+    ImGuiFileViewerArray<ImGuiFileViewerMatch> Matches;
+    std::atomic<ImU64>  SearchedSize;
+    std::atomic<bool>   SearchCancel;
+    std::thread         SearchThread;
+
+    ImGuiFileViewerState() { Data = ""; Size = 0; AllocFunc = NULL; FreeFunc = NULL; AllocatorUserData = NULL; LinesCount = IndexedSize = 0; IndexCancel = false; SearchActive = false; SearchedSize = 0; SearchCancel = false; }
+};
+
+template<typename T>
+static void FileViewerArrayInit(ImGuiFileViewerArray<T>* arr, ImU64 max_size)
+{
+    arr->BlocksCount = (size_t)(max_size >> ImGuiFileViewerArray<T>::BlockShift) + 1;
+    arr->Blocks = (T**)IM_ALLOC(arr->BlocksCount * sizeof(T*));
+    memset(arr->Blocks, 0, arr->BlocksCount * sizeof(T*));
+    arr->Size = 0;
+}
+
+// Called by the writer thread only
+template<typename T>
+static void FileViewerArrayPushBack(ImGuiFileViewerState* state, ImGuiFileViewerArray<T>* arr, const T& v)
+{
+    const size_t n = arr->Size.load(std::memory_order_relaxed);
+    T*& block = arr->Blocks[n >> ImGuiFileViewerArray<T>::BlockShift];
+    if (block == NULL)
+        block = (T*)state->AllocFunc(sizeof(T) * ImGuiFileViewerArray<T>::BlockSize, state->AllocatorUserData);
+    block[n & (ImGuiFileViewerArray<T>::BlockSize - 1)] = v;
+    arr->Size.store(n + 1, std::memory_order_release);
+}
+
+// Called by the main thread when the writer thread is not running
+template<typename T>
+static void FileViewerArrayClear(ImGuiFileViewerState* state, ImGuiFileViewerArray<T>* arr, bool free_table)
+{
+    for (size_t n = 0; n < arr->BlocksCount; n++)
+        if (arr->Blocks[n])
+        {
+            state->FreeFunc(arr->Blocks[n], state->AllocatorUserData);
+            arr->Blocks[n] = NULL;
+        }
+    arr->Size = 0;
+    if (free_table)
+    {
+        IM_FREE(arr->Blocks);
+        arr->Blocks = NULL;
+        arr->BlocksCount = 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+// File mapping
+//-------------------------------------------------------------------------
+
+static bool FileViewerMapFile(ImGuiFileViewerState* state, const char* filename)
+{
+#ifdef _WIN32
+    // Convert UTF-8 filename to wide characters (see ImFileOpen())
+    ImVector<ImWchar> filename_w;
+    filename_w.resize(ImTextCountCharsFromUtf8(filename, NULL) + 1);
+    ImTextStrFromUtf8(filename_w.Data, filename_w.Size, filename, NULL);
+    HANDLE file = ::CreateFileW((LPCWSTR)filename_w.Data, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size) || (ImU64)file_size.QuadPart > (ImU64)(size_t)-1)
+    {
+        ::CloseHandle(file);
+        return false;
+    }
+    state->Size = (ImU64)file_size.QuadPart;
+    if (state->Size > 0)
+    {
+        // The view stays valid after closing the file and mapping handles
+        HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        void* data = mapping ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+        if (mapping)
+            ::CloseHandle(mapping);
+        if (data == NULL)
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+        state->Data = (const char*)data;
+    }
+    ::CloseHandle(file);
+    return true;
+#else
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0 || (ImU64)file_stat.st_size > (ImU64)(size_t)-1)
+    {
+        ::close(fd);
+        return false;
+    }
+    state->Size = (ImU64)file_stat.st_size;
+    if (state->Size > 0)
+    {
+        // The mapping stays valid after closing the file descriptor
+        void* data = ::mmap(NULL, (size_t)state->Size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+        state->Data = (const char*)data;
+    }
+    ::close(fd);
+    return true;
+#endif
+}
+
+static void FileViewerUnmapFile(ImGuiFileViewerState* state)
+{
+    if (state->Size > 0)
+    {
+#ifdef _WIN32
+        ::UnmapViewOfFile(state->Data);
+#else
+        ::munmap((void*)state->Data, (size_t)state->Size);
+#endif
+    }
+    state->Data = "";
+    state->Size = 0;
+}
+
+//-------------------------------------------------------------------------
+// Background threads
+//-------------------------------------------------------------------------
+
+static void FileViewerIndexThread(ImGuiFileViewerState* state)
+{
+    const char* data = state->Data;
+    const char* data_end = data + state->Size;
+    const char* p = data;
+    ImU64 lines_count = 0;
+    while (p < data_end && !state->IndexCancel.load(std::memory_order_relaxed))
+    {
+        const char* publish_end = ((ImU64)(data_end - p) > FILEVIEWER_PUBLISH_SIZE) ? p + FILEVIEWER_PUBLISH_SIZE : data_end;
+        for (; p < publish_end; lines_count++)
+        {
+            if ((lines_count & FILEVIEWER_CHECKPOINT_MASK) == 0)
+                FileViewerArrayPushBack(state, &state->LineCheckpoints, (ImU64)(p - data));
+            const char* line_end = (const char*)memchr(p, '\n', (size_t)(data_end - p));
+            p = line_end ? line_end + 1 : data_end;
+        }
+        state->LinesCount.store(lines_count, std::memory_order_release);
+        state->IndexedSize.store((ImU64)(p - data), std::memory_order_release);
+    }
+}
+
+static void FileViewerSearchThread(ImGuiFileViewerState* state)
+{
+    const char* data = state->Data;
+    const char* data_end = data + state->Size;
+    const char* p = data;
+    ImU64 line_no = 0;
+    while (p < data_end && !state->SearchCancel.load(std::memory_order_relaxed))
+    {
+        const char* publish_end = ((ImU64)(data_end - p) > FILEVIEWER_PUBLISH_SIZE) ? p + FILEVIEWER_PUBLISH_SIZE : data_end;
+        for (; p < publish_end; line_no++)
+        {
+            const char* line_end = (const char*)memchr(p, '\n', (size_t)(data_end - p));
+            if (!line_end)
+                line_end = data_end;
+            if (state->SearchFilter.PassFilter(p, line_end))
+            {
+                ImGuiFileViewerMatch match = { (ImU64)(p - data), line_no };
+                FileViewerArrayPushBack(state, &state->Matches, match);
+            }
+            p = (line_end < data_end) ? line_end + 1 : data_end;
+        }
+        state->SearchedSize.store((ImU64)(p - data), std::memory_order_release);
+    }
+}
+
+static void FileViewerStopSearch(ImGuiFileViewerState* state)
+{
+    if (state->SearchThread.joinable())
+    {
+        state->SearchCancel = true;
+        state->SearchThread.join();
+    }
+    FileViewerArrayClear(state, &state->Matches, false);
+    state->SearchedSize = 0;
+    state->SearchCancel = false;
+    state->SearchActive = false;
+}
+
+static void FileViewerStartSearch(ImGuiFileViewerState* state, const ImGuiTextFilter* filter)
+{
+    IM_ASSERT(!state->SearchThread.joinable());
+    ImStrncpy(state->SearchFilter.InputBuf, filter->InputBuf, IM_ARRAYSIZE(state->SearchFilter.InputBuf));
+    state->SearchFilter.Build();
+    state->SearchActive = true;
+    state->SearchThread = std::thread(FileViewerSearchThread, state);
+}
+
+//-------------------------------------------------------------------------
+// ImGuiFileViewer
+//-------------------------------------------------------------------------
+
+ImGuiFileViewer::ImGuiFileViewer()
+{
+    FirstLine = 0;
+    MaxLineDisplayLength = 4096;
+    ShowLineNumbers = true;
+    State = NULL;
+}
+
+ImGuiFileViewer::~ImGuiFileViewer()
+{
+    Close();
+}
+
+bool ImGuiFileViewer::Open(const char* filename)
+{
+    Close();
+    ImGuiFileViewerState* state = IM_NEW(ImGuiFileViewerState)();
+    if (!FileViewerMapFile(state, filename))
+    {
+        IM_DELETE(state);
+        return false;
+    }
+
+    // A file of N bytes has at most N+1 lines
+    ImGui::GetAllocatorFunctions(&state->AllocFunc, &state->FreeFunc, &state->AllocatorUserData);
+    FileViewerArrayInit(&state->LineCheckpoints, ((state->Size + 1) >> FILEVIEWER_CHECKPOINT_SHIFT) + 1);
+    FileViewerArrayInit(&state->Matches, state->Size + 1);
+    state->IndexThread = std::thread(FileViewerIndexThread, state);
+    State = state;
+    FirstLine = 0;
+    return true;
+}
+
+void ImGuiFileViewer::Close()
+{
+    ImGuiFileViewerState* state = State;
+    if (state == NULL)
+        return;
+    if (state->IndexThread.joinable())
+    {
+        state->IndexCancel = true;
+        state->IndexThread.join();
+    }
+    FileViewerStopSearch(state);
+    FileViewerArrayClear(state, &state->LineCheckpoints, true);
+    FileViewerArrayClear(state, &state->Matches, true);
+    FileViewerUnmapFile(state);
+    IM_DELETE(state);
+    State = NULL;
+    FirstLine = 0;
+}
+
+ImU64 ImGuiFileViewer::GetFileSize() const
+{
+    return State ? State->Size : 0;
+}
+
+bool ImGuiFileViewer::IsIndexing() const
+{
+    return State && State->IndexedSize.load(std::memory_order_acquire) < State->Size;
+}
+
+float ImGuiFileViewer::GetIndexingProgress() const
+{
+    return (State && State->Size > 0) ? (float)((double)State->IndexedSize.load(std::memory_order_acquire) / (double)State->Size) : 1.0f;
+}
+
+ImU64 ImGuiFileViewer::GetLineCount() const
+{
+    return State ? State->LinesCount.load(std::memory_order_acquire) : 0;
+}
+
+bool ImGuiFileViewer::GetLine(ImU64 line_no, const char** out_begin, const char** out_end) const
+{
+    if (State == NULL || line_no >= State->LinesCount.load(std::memory_order_acquire))
+        return false;
+
+    // Start from the closest indexed line, and skip up to 63 lines
+    const char* data_end = State->Data + State->Size;
+    const char* line = State->Data + State->LineCheckpoints[(size_t)(line_no >> FILEVIEWER_CHECKPOINT_SHIFT)];
+    for (ImU64 n = line_no & FILEVIEWER_CHECKPOINT_MASK; n > 0; n--)
+        line = (const char*)memchr(line, '\n', (size_t)(data_end - line)) + 1;
+    const char* line_end = (const char*)memchr(line, '\n', (size_t)(data_end - line));
+    *out_begin = line;
+    *out_end = line_end ? line_end : data_end;
+    return true;
+}
+
+bool ImGuiFileViewer::IsSearching() const
+{
+    return State && State->SearchActive && State->SearchedSize.load(std::memory_order_acquire) < State->Size;
+}
+
+float ImGuiFileViewer::GetSearchProgress() const
+{
+    if (State == NULL || !State->SearchActive || State->Size == 0)
+        return 1.0f;
+    return (float)((double)State->SearchedSize.load(std::memory_order_acquire) / (double)State->Size);
+}
+
+ImU64 ImGuiFileViewer::GetMatchCount() const
+{
+    return (State && State->SearchActive) ? (ImU64)State->Matches.Size.load(std::memory_order_acquire) : 0;
+}
+
+bool ImGuiFileViewer::GetMatch(ImU64 match_no, ImU64* out_line_no, const char** out_begin, const char** out_end) const
+{
+    if (match_no >= GetMatchCount())
+        return false;
+    const ImGuiFileViewerMatch& match = State->Matches[(size_t)match_no];
+    const char* data_end = State->Data + State->Size;
+    const char* line = State->Data + match.Offset;
+    const char* line_end = (const char*)memchr(line, '\n', (size_t)(data_end - line));
+    if (out_line_no)
+        *out_line_no = match.LineNo;
+    *out_begin = line;
+    *out_end = line_end ? line_end : data_end;
+    return true;
+}
+
+void ImGuiFileViewer::Draw(const char* str_id, const ImGuiTextFilter* filter, const ImVec2& size)
+{
+    if (!ImGui::BeginChild(str_id, size, false, ImGuiWindowFlags_HorizontalScrollbar | ImGuiWindowFlags_NoScrollWithMouse))
+    {
+        ImGui::EndChild();
+        return;
+    }
+    ImGuiFileViewerState* state = State;
+    if (state == NULL)
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    // (Re)start search when the filter changes. When the filter is cleared, scroll to the line of the first visible match.
+    const bool use_filter = (filter != NULL && filter->IsActive());
+    if (use_filter != state->SearchActive || (use_filter && strcmp(filter->InputBuf, state->SearchFilter.InputBuf) != 0))
+    {
+        ImU64 first_line = 0;
+        const char* unused_begin;
+        const char* unused_end;
+        if (!use_filter && !GetMatch(FirstLine, &first_line, &unused_begin, &unused_end))
+            first_line = 0;
+        FileViewerStopSearch(state);
+        if (use_filter)
+            FileViewerStartSearch(state, filter);
+        FirstLine = first_line;
+    }
+
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    const float line_height = ImGui::GetTextLineHeight();
+    const ImU64 lines_count = use_filter ? GetMatchCount() : GetLineCount();
+    const int rows = ImMax((int)((window->InnerRect.GetHeight() - window->WindowPadding.y * 2.0f) / line_height), 1);
+    const ImU64 first_line_max = (lines_count > (ImU64)rows) ? lines_count - rows : 0;
+
+    // Scroll by line with the mouse wheel and our own scrollbar (see notes in imgui_file_viewer.h)
+    if (ImGui::IsWindowHovered() && g.IO.MouseWheel != 0.0f)
+    {
+        const ImU64 wheel_lines = (ImU64)ImMax(ImFabs(g.IO.MouseWheel) * FILEVIEWER_WHEEL_LINES, 1.0f);
+        FirstLine = (g.IO.MouseWheel > 0.0f) ? ((FirstLine > wheel_lines) ? FirstLine - wheel_lines : 0) : FirstLine + wheel_lines;
+    }
+    FirstLine = ImMin(FirstLine, first_line_max);
+
+    const ImRect scrollbar_bb(window->InnerRect.Max.x - g.Style.ScrollbarSize, window->InnerRect.Min.y, window->InnerRect.Max.x, window->InnerRect.Max.y);
+    const ImGuiID scrollbar_id = window->GetID("#SCROLLY");
+    const double scrollbar_scale = (lines_count > FILEVIEWER_SCROLLBAR_LINES_MAX) ? (double)lines_count / (double)FILEVIEWER_SCROLLBAR_LINES_MAX : 1.0;
+    float scroll_v = (float)((double)FirstLine / scrollbar_scale);
+    ImGui::KeepAliveID(scrollbar_id);
+    if (ImGui::ScrollbarEx(scrollbar_bb, scrollbar_id, ImGuiAxis_Y, &scroll_v, (float)(rows / scrollbar_scale), (float)((double)lines_count / scrollbar_scale), 0))
+        FirstLine = ImMin((ImU64)((double)scroll_v * scrollbar_scale), first_line_max);
+
+    // Line numbers are right-aligned to the number of digits of the last line indexed
+    int line_no_digits = 1;
+    for (ImU64 n = ImMax(GetLineCount(), (ImU64)1); n >= 10; n /= 10)
+        line_no_digits++;
+
+    // Visible lines. Consecutive lines are found from the previous one when not filtering.
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(g.Style.ItemSpacing.x, 0.0f));
+    ImGui::PushClipRect(window->InnerRect.Min, ImVec2(scrollbar_bb.Min.x, window->InnerRect.Max.y), true);
+    const char* data_end = state->Data + state->Size;
+    const char* line = NULL;
+    const char* line_end = NULL;
+    for (int row = 0; row < rows && FirstLine + row < lines_count; row++)
+    {
+        ImU64 line_no = FirstLine + row;
+        if (use_filter)
+            GetMatch(FirstLine + row, &line_no, &line, &line_end);
+        else if (row == 0)
+            GetLine(line_no, &line, &line_end);
+        else
+        {
+            line = line_end + 1;
+            line_end = (const char*)memchr(line, '\n', (size_t)(data_end - line));
+            if (!line_end)
+                line_end = data_end;
+        }
+        if (ShowLineNumbers)
+        {
+            ImGui::TextDisabled("%*llu", line_no_digits, (unsigned long long)(line_no + 1));
+            ImGui::SameLine();
+        }
+        ImGui::TextUnformatted(line, (line_end - line > MaxLineDisplayLength) ? line + MaxLineDisplayLength : line_end);
+    }
+    ImGui::PopClipRect();
+    ImGui::PopStyleVar();
+
+    // Allow scrolling horizontally past our scrollbar
+    window->DC.CursorMaxPos.x += g.Style.ScrollbarSize;
+    ImGui::EndChild();
+}
@@ -0,0 +1,56 @@
+// imgui_file_viewer.h
+// Read-only viewer for large text files (logs, CSV, etc.), backed by a memory-mapped file.
+// The line index and the filtering are done on background threads: frame time only depends on the number of visible lines.
+
+// Usage:
+//   static ImGuiFileViewer viewer;
+//   static ImGuiTextFilter filter;
+//   if (!viewer.IsOpen())
+//       viewer.Open("server.log");
+//   filter.Draw();
+//   viewer.Draw("##server_log", &filter);
+
+// Notes:
+// - The file is mapped with mmap() (POSIX) or MapViewOfFile() (Windows). A 64-bit build is needed to map files larger than ~2 GB.
+// - The mapping is not refreshed: text appended after Open() isn't visible, call Open() again. Truncating the file while it is open is
+//   undefined behavior (SIGBUS on POSIX).
+// - Lines are indexed on a background thread, and Draw() displays the lines indexed so far. The index stores the offset of one line
+//   every 64 lines (~0.1 byte per line for a typical log): lines in between are found with memchr() when displayed.
+// - When a filter is active, matching lines are searched on a second background thread, restarted whenever the filter changes.
+// - Scrolling is done by line rather than by pixel, as float positions can't address tens of millions of lines. Draw() doesn't use
+//   ImGuiListClipper for that reason, but you can display small files with your own clipper and GetLineCount()/GetLine().
+// - Background threads allocate memory using the functions returned by ImGui::GetAllocatorFunctions() when calling Open().
+
+// Compatibility:
+// - Requires C++11 (std::thread, std::atomic).
+
+// Changelog:
+// - v0.10: Initial version.
+
+#pragma once
+
+struct ImGuiFileViewerState;
+
+struct ImGuiFileViewer
+{
+    ImU64                   FirstLine;              // Index of the first displayed line (within the filtered lines when a filter is active)
+    int                     MaxLineDisplayLength;   // = 4096 // Longer lines are truncated when displayed. Filters are still applied to the whole line.
+    bool                    ShowLineNumbers;        // = true
+    ImGuiFileViewerState*   State;                  // File mapping, line index and search (NULL when not open)
+
+    IMGUI_API ImGuiFileViewer();
+    IMGUI_API ~ImGuiFileViewer();
+    IMGUI_API bool          Open(const char* filename);                 // Map file and start indexing lines. Return false if the file can't be opened or mapped.
+    IMGUI_API void          Close();                                    // Stop background threads and unmap file
+    bool                    IsOpen() const                  { return State != NULL; }
+    IMGUI_API ImU64         GetFileSize() const;
+    IMGUI_API bool          IsIndexing() const;
+    IMGUI_API float         GetIndexingProgress() const;                // 0.0f..1.0f
+    IMGUI_API ImU64         GetLineCount() const;                       // Lines indexed so far
+    IMGUI_API bool          GetLine(ImU64 line_no, const char** out_begin, const char** out_end) const; // Excluding '\n'. Return false if not indexed yet.
+    IMGUI_API bool          IsSearching() const;
+    IMGUI_API float         GetSearchProgress() const;                  // 0.0f..1.0f
+    IMGUI_API ImU64         GetMatchCount() const;                      // Lines passing the filter found so far
+    IMGUI_API bool          GetMatch(ImU64 match_no, ImU64* out_line_no, const char** out_begin, const char** out_end) const;
+    IMGUI_API void          Draw(const char* str_id, const ImGuiTextFilter* filter = NULL, const ImVec2& size = ImVec2(0, 0));
+};
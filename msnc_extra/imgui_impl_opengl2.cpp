@@ -18,6 +18,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2019-07-02: OpenGL: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT), texture coordinates are converted to floats.
+//  2019-06-12: OpenGL: Uploading font glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs) using io.Fonts->TexDirtyRects.
 //  2019-04-30: OpenGL: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-02-11: OpenGL: Projecting clipping rectangles correctly using draw_data->FramebufferScale to allow multi-viewports for retina display.
 //  2018-11-30: Misc: Setting up io.BackendRendererName so it can be displayed in the About Window.
@@ -60,6 +62,9 @@ static GLsizei      g_LastViewWidth   = APP_RES_X;
 static GLsizei      g_LastViewHeight  = APP_RES_Y;
 static GLuint       g_FontTexture     = 0;
 static GLuint       g_SnapshotTexture = 0;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+static ImVector<ImVec2> g_TexCoordsBuffer;      // Texture coordinates converted to floats
+#endif
 
 #define GL_SNAPSHOT_SIZE_X        4096
 #define GL_SNAPSHOT_SIZE_Y        4096
@@ -128,8 +133,35 @@ static void ImGui_ImplOpenGL2_SetupRenderState(GLint d_x, GLint d_y, GLsizei d_w
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
     glLoadIdentity();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Compact vertex layout: positions are in fixed-point
+    glScalef(1.0f / IM_DRAWVERT_POS_SCALE, 1.0f / IM_DRAWVERT_POS_SCALE, 1.0f);
+#endif
 }
 
+// Upload glyphs rasterized since last frame (ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplOpenGL2_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.empty() || !g_FontTexture)
+        return;
+
+    GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    GLint last_unpack_alignment; glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlasDirtyRect& r = atlas->TexDirtyRects[n];
+        glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, GL_ALPHA, GL_UNSIGNED_BYTE, atlas->TexPixelsAlpha8 + r.Y * atlas->TexWidth + r.X);
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment);
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+    atlas->TexDirtyRects.clear();
+}
+
 // OpenGL2 Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly, in order to be able to run within any OpenGL engine that doesn't do so.
@@ -141,6 +173,8 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     if (!g_ViewWidth || !g_ViewHeight)
         return;
 
+    ImGui_ImplOpenGL2_UpdateFontsTexture();
+
     // Backup GL state
     GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
     GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
@@ -165,8 +199,17 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
         const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Compact vertex layout: glTexCoordPointer() doesn't support normalized 16-bit texture coordinates, convert them to floats
+        g_TexCoordsBuffer.resize(cmd_list->VtxBuffer.Size);
+        for (int vtx_i = 0; vtx_i < cmd_list->VtxBuffer.Size; vtx_i++)
+            g_TexCoordsBuffer.Data[vtx_i] = vtx_buffer[vtx_i].uv;
+        glVertexPointer(2, GL_SHORT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
+        glTexCoordPointer(2, GL_FLOAT, sizeof(ImVec2), (const GLvoid*)g_TexCoordsBuffer.Data);
+#else
         glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
         glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, uv)));
+#endif
         glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)));
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
@@ -236,6 +279,7 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, width, height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+    io.Fonts->TexDirtyRects.clear();
 
     // Store our identifier
     io.Fonts->TexID = (ImTextureID)(intptr_t)g_FontTexture;
@@ -255,6 +299,9 @@ void ImGui_ImplOpenGL2_DestroyFontsTexture()
         io.Fonts->TexID = (ImTextureID)(intptr_t)0;
         g_FontTexture = 0;
     }
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    g_TexCoordsBuffer.clear();
+#endif
 }
 
 void ImGui_ImplOpenGL2_RenderSnapshot() 
@@ -265,6 +312,9 @@ void ImGui_ImplOpenGL2_RenderSnapshot()
 
     // Setup desired GL state
     ImGui_ImplOpenGL2_SetupRenderState(0, 0, g_ViewWidth, g_ViewHeight, g_ViewWidth, g_ViewHeight);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glLoadIdentity(); // The quad below uses float positions
+#endif
 
     // Apply scissor/clipping rectangle
     glScissor(0, 0, (GLsizei)g_ViewWidth, (GLsizei)g_ViewHeight);